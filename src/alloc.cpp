@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2025 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -18,6 +18,9 @@
  */
 
 # include "dgd.h"
+# ifdef HUGEPAGES
+# include <sys/mman.h>
+# endif
 
 # define SIZE_SHIFT	(8 * (sizeof(size_t) - 1))
 # define MAGIC_MASK	((size_t) 0xc0 << SIZE_SHIFT)	/* magic number mask */
@@ -28,6 +31,23 @@
 
 # define SIZETSIZE	ALGN(sizeof(size_t), STRUCT_AL)
 
+# ifdef HUGEPAGES
+# define HUGEPAGE	2097152		/* huge page size */
+# endif
+
+/*
+ * header of a chunk obtained from the system
+ */
+struct MemBlock {
+    class MemChunk *next;		/* next block in list */
+# ifdef HUGEPAGES
+    size_t mapped;			/* size of mapping, or 0 */
+    bool hugetlb;			/* mapped with explicit huge pages? */
+# endif
+};
+
+# define MBSIZE		ALGN(sizeof(MemBlock), STRUCT_AL)
+
 
 class MemChunk {
 public:
@@ -37,20 +57,32 @@ public:
     static MemChunk *alloc(size_t size, MemChunk **list) {
 	MemChunk *mem;
 
-	if (list != (MemChunk **) NULL) {
-	    size += ALGN(sizeof(MemChunk *), STRUCT_AL);
-	}
-	mem = (MemChunk *) std::malloc(size);
-	if (mem == (MemChunk *) NULL) {
-	    EC->fatal("out of memory");
+	if (list == (MemChunk **) NULL) {
+	    mem = (MemChunk *) std::malloc(size);
+	    if (mem == (MemChunk *) NULL) {
+		EC->fatal("out of memory");
+	    }
+	    return mem;
 	}
-	if (list != (MemChunk **) NULL) {
-	    *((MemChunk **) mem) = *list;
-	    *list = mem;
-	    mem = (MemChunk *) ((char *) mem +
-				ALGN(sizeof(MemChunk *), STRUCT_AL));
+
+	size += MBSIZE;
+# ifdef HUGEPAGES
+	if (size >= HUGEPAGE) {
+	    mem = map(size);
+	} else
+# endif
+	{
+	    mem = (MemChunk *) std::malloc(size);
+	    if (mem == (MemChunk *) NULL) {
+		EC->fatal("out of memory");
+	    }
+# ifdef HUGEPAGES
+	    ((MemBlock *) mem)->mapped = 0;
+# endif
 	}
-	return mem;
+	((MemBlock *) mem)->next = *list;
+	*list = mem;
+	return (MemChunk *) ((char *) mem + MBSIZE);
     }
 
     /*
@@ -59,11 +91,88 @@ public:
     static MemChunk *free(MemChunk *mem) {
 	MemChunk *next;
 
-	next = *(MemChunk **) mem;
+	next = ((MemBlock *) mem)->next;
+# ifdef HUGEPAGES
+	if (((MemBlock *) mem)->mapped != 0) {
+	    unmap((MemBlock *) mem);
+	    return next;
+	}
+# endif
 	std::free(mem);
 	return next;
     }
 
+    /*
+     * round up a chunk size so that, with its header, it fills a whole
+     * number of huge pages
+     */
+    static size_t fit(size_t size) {
+# ifdef HUGEPAGES
+	if (size + MBSIZE >= HUGEPAGE) {
+	    size = ALGN(size + MBSIZE, HUGEPAGE) - MBSIZE;
+	}
+	return size;
+# else
+	return size;
+# endif
+    }
+
+# ifdef HUGEPAGES
+    /*
+     * map memory in huge pages, explicit if possible, transparent otherwise
+     */
+    static MemChunk *map(size_t size) {
+	char *mem, *p;
+
+	size = ALGN(size, HUGEPAGE);
+# ifdef MAP_HUGETLB
+	mem = (char *) mmap((void *) NULL, size, PROT_READ | PROT_WRITE,
+			    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	if (mem != (char *) MAP_FAILED) {
+	    ((MemBlock *) mem)->mapped = size;
+	    ((MemBlock *) mem)->hugetlb = TRUE;
+	    hugeMem += size;
+	    return (MemChunk *) mem;
+	}
+# endif
+
+	/* align on a huge page boundary, so the kernel can use huge pages */
+	mem = (char *) mmap((void *) NULL, size + HUGEPAGE,
+			    PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+			    -1, 0);
+	if (mem == (char *) MAP_FAILED) {
+	    EC->fatal("out of memory");
+	}
+	p = (char *) ALGN((uintptr_t) mem, HUGEPAGE);
+	if (p != mem) {
+	    munmap(mem, p - mem);
+	}
+	munmap(p + size, mem + HUGEPAGE - p);
+# ifdef MADV_HUGEPAGE
+	madvise(p, size, MADV_HUGEPAGE);
+# endif
+	((MemBlock *) p)->mapped = size;
+	((MemBlock *) p)->hugetlb = FALSE;
+	thpMem += size;
+	return (MemChunk *) p;
+    }
+
+    /*
+     * unmap memory
+     */
+    static void unmap(MemBlock *mem) {
+	if (mem->hugetlb) {
+	    hugeMem -= mem->mapped;
+	} else {
+	    thpMem -= mem->mapped;
+	}
+	munmap((char *) mem, mem->mapped);
+    }
+
+    static size_t hugeMem;		/* memory in explicit huge pages */
+    static size_t thpMem;		/* memory in transparent huge pages */
+# endif
+
     size_t size;			/* size of chunk */
     union {
 	MemChunk *next;			/* next chunk */
@@ -71,6 +180,11 @@ public:
     };
 };
 
+# ifdef HUGEPAGES
+size_t MemChunk::hugeMem;
+size_t MemChunk::thpMem;
+# endif
+
 # ifdef DEBUG
 /*
  * debug extension of chunk
@@ -153,7 +267,7 @@ unsigned int ChunkList::nLists;
 class StaticMem {
 public:
     static void init(size_t size) {
-	schunksz = ALGN(size, STRUCT_AL);
+	schunksz = MemChunk::fit(ALGN(size, STRUCT_AL));
 	if (schunksz != 0) {
 	    if (schunk != (MemChunk *) NULL) {
 		schunk->next = sflist;
@@ -581,13 +695,27 @@ public:
 
 # define DSMALL		64
 # define DLIMIT		(DSMALL + MOFFSET)
-# define DCHUNKS	(DSMALL / STRUCT_AL - 1)
-# define DCHUNKSZ	32768
+# define DSLAB		(DSMALL << 4)
+# define DSLIMIT	(DSLAB + MOFFSET)
+# define DCLASSES	(DSMALL / STRUCT_AL + 4 * 4)
+# define DSLABSZ	16384
+
+/*
+ * Chunks up to DSLAB bytes come from per-size-class slabs.  Sizes below
+ * DSMALL each have a class of their own; above that, there are four
+ * classes per power of two.
+ */
+class SizeClass {
+public:
+    MemChunk *flist;		/* free list */
+    char *slab;			/* unused part of current slab */
+    size_t left;		/* bytes left in current slab */
+};
 
 class DynamicMem {
 public:
     static void init(size_t size) {
-	dchunksz = ALGN(size, STRUCT_AL);
+	dchunksz = MemChunk::fit(ALGN(size, STRUCT_AL));
     }
 
     static void purge() {
@@ -595,16 +723,46 @@ public:
 	while (dlist != (MemChunk *) NULL) {
 	    dlist = MemChunk::free(dlist);
 	}
-	memset(dchunks, '\0', sizeof(dchunks));
-	dchunk = (MemChunk *) NULL;
+	memset(dclasses, '\0', sizeof(dclasses));
 	dtree = (SplayNode *) NULL;
 	memSize = memUsed = 0;
+	slabSize = slabUsed = 0;
     }
 
     static void finish() {
 	dchunksz = 0;
     }
 
+    /*
+     * find the size class for a small chunk, and round up its size
+     */
+    static unsigned int sizeClass(size_t *size) {
+	size_t n;
+	unsigned int shift, sub;
+
+	n = *size - MOFFSET;
+	if (n <= DSMALL) {
+	    return n / STRUCT_AL - 1;
+	}
+
+	--n;
+	for (shift = 6; (n >> (shift + 1)) != 0; shift++) ;
+	sub = (n >> (shift - 2)) & 3;
+	*size = ((size_t) (4 + sub + 1) << (shift - 2)) + MOFFSET;
+	return DSMALL / STRUCT_AL + (shift - 6) * 4 + sub;
+    }
+
+    /*
+     * the size of the chunk that would be allocated
+     */
+    static size_t chunkSize(size_t size) {
+	if (size <= DSLIMIT) {
+	    sizeClass(&size);
+	    return size;
+	}
+	return size + SIZETSIZE;
+    }
+
     /*
      * allocate dynamic memory
      */
@@ -623,35 +781,32 @@ public:
 	}
 	StaticMem::dmem = TRUE;
 
-	if (size < DLIMIT) {
+	if (size <= DSLIMIT) {
+	    SizeClass *sc;
+
 	    /*
 	     * small chunk
 	     */
-	    if ((c=dchunks[(size - MOFFSET) / STRUCT_AL - 1]) !=
-							    (MemChunk *) NULL) {
+	    sc = &dclasses[sizeClass(&size)];
+	    if ((c=sc->flist) != (MemChunk *) NULL) {
 		/* small chunk from free list */
-		dchunks[(size - MOFFSET) / STRUCT_AL - 1] = c->next;
-		return c;
-	    }
-	    if (dchunk == (MemChunk *) NULL) {
-		/* get new chunks chunk */
-		dchunk = alloc(DCHUNKSZ);
-		p = (char *) dchunk + SIZETSIZE;
-		((MemChunk *) p)->size = dchunk->size - SIZETSIZE - SIZETSIZE;
-		dchunk->size |= DM_MAGIC;
-		dchunk = (MemChunk *) p;
-	    }
-	    sz = dchunk->size - size;
-	    c = dchunk;
-	    c->size = size;
-	    if (sz >= DLIMIT - STRUCT_AL) {
-		/* enough is left for another small chunk */
-		dchunk = (MemChunk *) ((char *) c + size);
-		dchunk->size = sz;
+		sc->flist = c->next;
 	    } else {
-		/* waste sz bytes of memory */
-		dchunk = (MemChunk *) NULL;
+		if (sc->left == 0) {
+		    /* get new slab */
+		    c = alloc((DSLABSZ / size) * size + SIZETSIZE);
+		    sc->slab = (char *) c + SIZETSIZE;
+		    sc->left = c->size - SIZETSIZE - SIZETSIZE;
+		    sc->left -= sc->left % size;
+		    slabSize += sc->left;
+		    c->size |= DM_MAGIC;
+		}
+		c = (MemChunk *) sc->slab;
+		sc->slab += size;
+		sc->left -= size;
 	    }
+	    c->size = size;
+	    slabUsed += size;
 	    return c;
 	}
 
@@ -712,17 +867,23 @@ public:
 	    /*
 	     * memory manager not yet initialized
 	     */
-	    MemChunk::free(c);
+	    std::free(c);
 	    return;
 	}
 
 # ifdef DEBUG
 	memset(c + 1, '\xdd', c->size - sizeof(MemChunk) - SIZETSIZE);
 # endif
-	if (c->size < DLIMIT) {
+	if (c->size <= DSLIMIT) {
+	    SizeClass *sc;
+	    size_t size;
+
 	    /* small chunk */
-	    c->next = dchunks[(c->size - MOFFSET) / STRUCT_AL - 1];
-	    dchunks[(c->size - MOFFSET) / STRUCT_AL - 1] = c;
+	    size = c->size;
+	    sc = &dclasses[sizeClass(&size)];
+	    c->next = sc->flist;
+	    sc->flist = c;
+	    slabUsed -= size;
 	    return;
 	}
 
@@ -767,20 +928,24 @@ public:
 
     static SplayNode *dtree;	/* splay tree of large dynamic free chunks */
     static MemChunk *dlist;		/* list of dynamic memory chunks */
-    static MemChunk *dchunks[DCHUNKS];	/* list of free small chunks */
-    static MemChunk *dchunk;		/* chunk of small chunks */
+    static SizeClass dclasses[DCLASSES];	/* small chunk size classes */
     static size_t dchunksz;		/* dynamic chunk size */
     static size_t memSize;		/* dynamic memory size */
     static size_t memUsed;		/* dynamic memory used */
+    static size_t memAlloc;		/* dynamic memory allocated in total */
+    static size_t slabSize;		/* memory in slabs */
+    static size_t slabUsed;		/* slab memory used */
 };
 
 SplayNode *DynamicMem::dtree;		/* large dynamic free chunks */
 MemChunk *DynamicMem::dlist;		/* list of dynamic memory chunks */
-MemChunk *DynamicMem::dchunks[DCHUNKS];	/* list of free small chunks */
-MemChunk *DynamicMem::dchunk;		/* chunk of small chunks */
+SizeClass DynamicMem::dclasses[DCLASSES];	/* small chunk size classes */
 size_t DynamicMem::dchunksz;		/* dynamic chunk size */
 size_t DynamicMem::memSize;		/* dynamic memory size */
 size_t DynamicMem::memUsed;		/* dynamic memory used */
+size_t DynamicMem::memAlloc;		/* dynamic memory allocated in total */
+size_t DynamicMem::slabSize;		/* memory in slabs */
+size_t DynamicMem::slabUsed;		/* slab memory used */
 
 
 # ifdef DEBUG
@@ -849,6 +1014,7 @@ char *AllocImpl::alloc(size_t size)
     } else {
 	c = DynamicMem::alloc(size);
 	DynamicMem::memUsed += c->size;
+	DynamicMem::memAlloc += c->size;
 	c->size |= DM_MAGIC;
 # ifdef DEBUG
 	((MemHeader *) c)->prev = (MemHeader *) NULL;
@@ -954,14 +1120,14 @@ char *AllocImpl::realloc(char *mem, size_t size1, size_t size2)
 	    EC->fatal("bad size1 in m_realloc");
 	}
 # endif
-	if ((c1->size & SIZE_MASK) < ((size2 < DLIMIT) ?
-				       size2 : size2 + SIZETSIZE)) {
+	if ((c1->size & SIZE_MASK) < DynamicMem::chunkSize(size2)) {
 	    c2 = DynamicMem::alloc(size2);
 	    if (size1 != 0) {
 		memcpy((char *) c2 + MOFFSET, mem, size1);
 	    }
 	    c1->size &= SIZE_MASK;
 	    DynamicMem::memUsed += c2->size - c1->size;
+	    DynamicMem::memAlloc += c2->size;
 	    c2->size |= DM_MAGIC;
 # ifdef DEBUG
 	    c2->next = c1->next;
@@ -1009,7 +1175,7 @@ void AllocImpl::purge()
 	size_t n, len;
 
 	n = (hlist->size & SIZE_MASK) - MOFFSET;
-	if (n >= DLIMIT) {
+	if (n > DSLAB) {
 	    n -= SIZETSIZE;
 	}
 # ifdef MEMDEBUG
@@ -1051,6 +1217,15 @@ Alloc::Info *AllocImpl::info()
     mstat.smemused = StaticMem::memUsed;
     mstat.dmemsize = DynamicMem::memSize;
     mstat.dmemused = DynamicMem::memUsed;
+    mstat.dmemalloc = DynamicMem::memAlloc;
+    mstat.dmemslab = DynamicMem::slabSize;
+    mstat.dmemslabused = DynamicMem::slabUsed;
+# ifdef HUGEPAGES
+    mstat.hugemem = MemChunk::hugeMem;
+    mstat.thpmem = MemChunk::thpMem;
+# else
+    mstat.hugemem = mstat.thpmem = 0;
+# endif
     return &mstat;
 }
 
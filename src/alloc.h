@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -24,6 +24,11 @@ public:
 	size_t smemused;	/* static memory used */
 	size_t dmemsize;	/* dynamic memory used */
 	size_t dmemused;	/* dynamic memory used */
+	size_t dmemalloc;	/* dynamic memory allocated in total */
+	size_t dmemslab;	/* dynamic memory in size class slabs */
+	size_t dmemslabused;	/* slab memory used */
+	size_t hugemem;		/* memory mapped in explicit huge pages */
+	size_t thpmem;		/* memory advised for transparent huge pages */
     };
 
     virtual void init(size_t staticSize, size_t dynamicSize) {
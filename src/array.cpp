@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -30,6 +30,15 @@ static int cmp (cvoid*, cvoid*);
 
 # define ARR_CHUNK	128
 
+# ifdef LARGESIZE
+/* temporary copies of large arrays do not fit on the stack */
+# define TALLOC(type, size)	ALLOC(type, size)
+# define TFREE(ptr)		FREE(ptr)
+# else
+# define TALLOC(type, size)	ALLOCA(type, size)
+# define TFREE(ptr)		AFREE(ptr)
+# endif
+
 class ArrHash : public ChunkAllocated {
 public:
     ArrHash(Array *a, Uint idx) {
@@ -153,6 +162,7 @@ public:
 
     Uint hashval;		/* hash value of index */
     bool add;			/* new element? */
+    ssizet slot;		/* index in list of new elements */
     Value idx;			/* index */
     Value val;			/* value */
     MapElt *next;		/* next in hash table */
@@ -170,9 +180,11 @@ public:
 	tablesize = MTABLE_SIZE;
 	table = ALLOC(MapElt*, tablesize);
 	memset(table, '\0', tablesize * sizeof(MapElt*));
+	addsize = 0;
+	added = (MapElt **) NULL;
     }
     ~MapHash() {
-	unsigned short i;
+	ssizet i;
 	MapElt *e, *n, **t;
 
 	for (i = size, t = table; i > 0; t++) {
@@ -183,6 +195,9 @@ public:
 	    }
 	}
 	FREE(table);
+	if (added != (MapElt **) NULL) {
+	    FREE(added);
+	}
     }
 
     /*
@@ -190,7 +205,7 @@ public:
      */
     void shallowDelete()
     {
-	unsigned short i;
+	ssizet i;
 	MapElt *e, *n, **t;
 
 	for (i = size, t = table; i > 0; t++) {
@@ -216,7 +231,7 @@ public:
      * extend hashtable
      */
     void grow() {
-	unsigned short i;
+	ssizet i;
 	Uint j;
 	MapElt *e, *n, **t, **newTable;
 
@@ -251,6 +266,19 @@ public:
 	return table[i] = chunknew (mechunk) MapElt(hashval, table[i]);
     }
 
+    /*
+     * mark MapElt as a new element
+     */
+    void mark(MapElt *e) {
+	if (sizemod == addsize) {
+	    addsize = (addsize == 0) ? MTABLE_SIZE : addsize << 1;
+	    added = REALLOC(added, MapElt*, sizemod, addsize);
+	}
+	e->add = TRUE;
+	e->slot = sizemod;
+	added[sizemod++] = e;
+    }
+
     /*
      * remove MapElt
      */
@@ -258,8 +286,13 @@ public:
 	MapElt *e;
 
 	e = *p;
-	if (e->add && --sizemod == 0) {
-	    m->hashmod = FALSE;
+	if (e->add) {
+	    /* move the last new element into its slot */
+	    added[e->slot] = added[--sizemod];
+	    added[e->slot]->slot = e->slot;
+	    if (sizemod == 0) {
+		m->hashmod = FALSE;
+	    }
 	}
 	*p = e->next;
 	e->remove(data, m);
@@ -274,7 +307,7 @@ public:
 
 	for (p = &table[i % tablesize];
 	     (e=*p) != (MapElt *) NULL; p = &e->next) {
-	    if (cmp(val, &e->idx) == 0 &&
+	    if (e->hashval == i && cmp(val, &e->idx) == 0 &&
 		(!T_INDEXED(val->type) || val->array == e->idx.array)) {
 		return p;
 	    }
@@ -286,10 +319,24 @@ public:
     /*
      * collect MapElts from hash table
      */
-    unsigned short collect(Value *v, Array *m, Dataspace *data) {
-	unsigned short i, j;
+    ssizet collect(Value *v, Array *m, Dataspace *data) {
+	ssizet i, j;
 	MapElt *e, **p, **t;
 
+	if (m == (Array *) NULL) {
+	    /*
+	     * nothing to clean: only the new elements are needed
+	     */
+	    for (i = 0; i < sizemod; i++) {
+		e = added[i];
+		e->add = FALSE;
+		*v++ = e->idx;
+		*v++ = e->val;
+	    }
+	    sizemod = 0;
+	    return i;
+	}
+
 	t = table;
 	for (i = size, size = sizemod = j = 0; i > 0; ) {
 	    for (p = t++; (e=*p) != (MapElt *) NULL; --i) {
@@ -313,10 +360,12 @@ public:
 	return j;
     }
 
-    unsigned short size;	/* # elements in hash table */
-    unsigned short sizemod;	/* mapping size modification */
+    ssizet size;		/* # elements in hash table */
+    ssizet sizemod;		/* mapping size modification */
     Uint tablesize;		/* actual hash table size */
     MapElt **table;		/* hash table */
+    Uint addsize;		/* size of list of new elements */
+    MapElt **added;		/* new elements */
 };
 
 static Chunk<MapHash, ARR_CHUNK> mhchunk;
@@ -325,7 +374,7 @@ static Chunk<MapHash, ARR_CHUNK> mhchunk;
 
 class ArrBak : public ChunkAllocated {
 public:
-    ArrBak(Array *a, Value *elts, unsigned short size, Dataplane *plane) {
+    ArrBak(Array *a, Value *elts, ssizet size, Dataplane *plane) {
 	arr = a;
 	original = elts;
 	this->size = size;
@@ -338,7 +387,7 @@ public:
     void commit() {
 	if (original != (Value *) NULL) {
 	    Value *v;
-	    unsigned short i;
+	    ssizet i;
 
 	    for (v = original, i = size; i != 0; v++, --i) {
 		v->del();
@@ -359,7 +408,7 @@ public:
     }
 
     Array *arr;			/* array backed up */
-    unsigned short size;	/* original size (of mapping) */
+    ssizet size;		/* original size (of mapping) */
     Value *original;		/* original elements */
     Dataplane *plane;		/* original dataplane */
 };
@@ -446,7 +495,7 @@ void Array::init(unsigned int size)
     atag = 0;
 }
 
-Array::Array(unsigned short size)
+Array::Array(ssizet size)
 {
     this->size = size;
     elts = (Value *) NULL;
@@ -460,7 +509,7 @@ Array::Array(unsigned short size)
 void Array::deepDelete()
 {
     Value *v;
-    unsigned short i;
+    ssizet i;
 
     if ((v=elts) != (Value *) NULL) {
 	for (i = size; i > 0; --i) {
@@ -477,7 +526,7 @@ void Array::deepDelete()
 void Array::shallowDelete()
 {
     Value *v;
-    unsigned short i;
+    ssizet i;
 
     if ((v=elts) != (Value *) NULL) {
 	for (i = size; i > 0; --i) {
@@ -494,7 +543,7 @@ void Array::shallowDelete()
 /*
  * allocate a new array
  */
-Array *Array::alloc(unsigned short size)
+Array *Array::alloc(ssizet size)
 {
     return chunknew (achunk) Array(size);
 }
@@ -509,7 +558,7 @@ Array *Array::create(Dataspace *data, LPCint size)
     if (size > max_size) {
 	EC->error("Array too large");
     }
-    a = alloc((unsigned short) size);
+    a = alloc((ssizet) size);
     if (size > 0) {
 	a->elts = ALLOC(Value, size);
     }
@@ -657,7 +706,7 @@ void Array::clear()
 void Array::backup(Backup **ac)
 {
     Value *v;
-    unsigned short i;
+    ssizet i;
 
     if (size != 0) {
 	memcpy(v = ALLOC(Value, size), elts, size * sizeof(Value));
@@ -715,7 +764,7 @@ void Array::discard(Backup **ac)
 static void copytmp(Dataspace *data, Value *v1, Array *a)
 {
     Value *v2, *o;
-    unsigned short n;
+    ssizet n;
 
     v2 = Dataspace::elts(a);
     if (a->objDestrCount == ::objDestrCount) {
@@ -816,12 +865,12 @@ static int cmp(cvoid *cv1, cvoid *cv2)
 /*
  * search for a value in an array
  */
-static int search(Value *v1, Value *v2, unsigned short h, int step, bool place)
+static int search(Value *v1, Value *v2, ssizet h, int step, bool place)
 {
-    unsigned short l, m;
+    ssizet l, m;
     int c;
     Value *v3;
-    unsigned short mask;
+    ssizet mask;
 
     mask = -step;
     l = 0;
@@ -887,6 +936,139 @@ static int search(Value *v1, Value *v2, unsigned short h, int step, bool place)
     return (place) ? l : -1;
 }
 
+# define SET_HASHMIN	4	/* smallest set looked up by hashing */
+
+/*
+ * A set of values to test for membership.  Sets of ints, objects or
+ * strings are hashed, other sets are sorted and searched.
+ */
+class ValSet {
+public:
+    /*
+     * prepare a set of values
+     */
+    void init(Value *v, ssizet n) {
+	Value *w;
+	ssizet i;
+	Uint sz, h;
+
+	elts = v;
+	size = n;
+	table = (Uint *) NULL;
+	type = T_NIL;
+	nil = FALSE;
+
+	if (n >= SET_HASHMIN) {
+	    for (w = v, i = n; i > 0; w++, --i) {
+		if (w->type == T_NIL) {
+		    nil = TRUE;
+		} else if (w->type != type) {
+		    if (type != T_NIL) {
+			type = T_MIXED;	/* not homogeneous */
+			break;
+		    }
+		    type = w->type;
+		}
+	    }
+	    if (type == T_INT || type == T_OBJECT || type == T_STRING) {
+		/* at most half full */
+		for (sz = 2, shift = 63; sz < 2 * (Uint) n; sz <<= 1, --shift) ;
+		mask = sz - 1;
+		table = ALLOC(Uint, sz);
+		memset(table, '\0', sz * sizeof(Uint));
+		for (i = 0; i < n; v++, i++) {
+		    if (v->type != T_NIL) {
+			for (h = hash(v); table[h] != 0; h = (h + 1) & mask) ;
+			table[h] = i + 1;
+		    }
+		}
+		return;
+	    }
+	}
+
+	std::qsort(v, n, sizeof(Value), cmp);
+    }
+
+    /*
+     * release the hash table, if any
+     */
+    void clear() {
+	if (table != (Uint *) NULL) {
+	    FREE(table);
+	}
+    }
+
+    /*
+     * check whether a value is in the set
+     */
+    bool member(Value *v) {
+	Uint h, i;
+	Value *w;
+
+	if (table == (Uint *) NULL) {
+	    return (search(v, elts, size, 1, FALSE) >= 0);
+	}
+	if (v->type != type) {
+	    return (v->type == T_NIL && nil);
+	}
+
+	for (h = hash(v); (i = table[h]) != 0; h = (h + 1) & mask) {
+	    w = &elts[i - 1];
+	    switch (type) {
+	    case T_INT:
+		if (v->number == w->number) {
+		    return TRUE;
+		}
+		break;
+
+	    case T_OBJECT:
+		if (v->oindex == w->oindex) {
+		    return TRUE;
+		}
+		break;
+
+	    case T_STRING:
+		if (v->string == w->string || v->string->cmp(w->string) == 0) {
+		    return TRUE;
+		}
+		break;
+	    }
+	}
+	return FALSE;
+    }
+
+private:
+    /*
+     * hash a value to a table index
+     */
+    Uint hash(Value *v) {
+	uint64_t h;
+
+	switch (type) {
+	case T_INT:
+	    h = (uint64_t) v->number;
+	    break;
+
+	case T_OBJECT:
+	    h = v->oindex;
+	    break;
+
+	default:
+	    h = HM->hashmem64(v->string->text, v->string->len);
+	    break;
+	}
+	return (Uint) ((h * 0x9e3779b97f4a7c15ULL) >> shift);
+    }
+
+    Value *elts;		/* values in the set */
+    ssizet size;		/* number of values */
+    Uint *table;		/* hash table, or NULL if sorted */
+    Uint mask;			/* hash table mask */
+    int shift;			/* hash shift */
+    char type;			/* type of hashed values */
+    bool nil;			/* nil in hashed set? */
+};
+
 /*
  * subtract one array from another
  */
@@ -894,7 +1076,8 @@ Array *Array::sub(Dataspace *data, Array *a2)
 {
     Value *v1, *v2, *v3, *o;
     Array *a3;
-    unsigned short n;
+    ssizet n;
+    ValSet set;
 
     if (a2->size == 0) {
 	/*
@@ -914,15 +1097,15 @@ Array *Array::sub(Dataspace *data, Array *a2)
 	return a3;
     }
 
-    /* copy and sort values of subtrahend */
-    copytmp(data, v2 = ALLOCA(Value, a2->size), a2);
-    std::qsort(v2, a2->size, sizeof(Value), cmp);
+    /* copy values of subtrahend to a set */
+    copytmp(data, v2 = TALLOC(Value, a2->size), a2);
+    set.init(v2, a2->size);
 
     v1 = Dataspace::elts(this);
     v3 = a3->elts;
     if (objDestrCount == ::objDestrCount) {
 	for (n = size; n > 0; --n) {
-	    if (search(v1, v2, a2->size, 1, FALSE) < 0) {
+	    if (!set.member(v1)) {
 		/*
 		 * not found in subtrahend: copy to result array
 		 */
@@ -950,7 +1133,7 @@ Array *Array::sub(Dataspace *data, Array *a2)
 		}
 		break;
 	    }
-	    if (search(v1, v2, a2->size, 1, FALSE) < 0) {
+	    if (!set.member(v1)) {
 		/*
 		 * not found in subtrahend: copy to result array
 		 */
@@ -960,7 +1143,8 @@ Array *Array::sub(Dataspace *data, Array *a2)
 	    v1++;
 	}
     }
-    AFREE(v2);	/* free copy of values of subtrahend */
+    set.clear();
+    TFREE(v2);	/* free copy of values of subtrahend */
 
     a3->size = v3 - a3->elts;
     if (a3->size == 0) {
@@ -979,7 +1163,8 @@ Array *Array::intersect(Dataspace *data, Array *a2)
 {
     Value *v1, *v2, *v3, *o;
     Array *a3;
-    unsigned short n;
+    ssizet n;
+    ValSet set;
 
     if (size == 0 || a2->size == 0) {
 	/* array & ({ }) */
@@ -989,15 +1174,15 @@ Array *Array::intersect(Dataspace *data, Array *a2)
     /* create new array */
     a3 = create(data, size);
 
-    /* copy and sort values of 2nd array */
-    copytmp(data, v2 = ALLOCA(Value, a2->size), a2);
-    std::qsort(v2, a2->size, sizeof(Value), cmp);
+    /* copy values of 2nd array to a set */
+    copytmp(data, v2 = TALLOC(Value, a2->size), a2);
+    set.init(v2, a2->size);
 
     v1 = Dataspace::elts(this);
     v3 = a3->elts;
     if (objDestrCount == ::objDestrCount) {
 	for (n = size; n > 0; --n) {
-	    if (search(v1, v2, a2->size, 1, FALSE) >= 0) {
+	    if (set.member(v1)) {
 		/*
 		 * element is in both arrays: copy to result array
 		 */
@@ -1025,7 +1210,7 @@ Array *Array::intersect(Dataspace *data, Array *a2)
 		}
 		break;
 	    }
-	    if (search(v1, v2, a2->size, 1, FALSE) >= 0) {
+	    if (set.member(v1)) {
 		/*
 		 * element is in both arrays: copy to result array
 		 */
@@ -1035,7 +1220,8 @@ Array *Array::intersect(Dataspace *data, Array *a2)
 	    v1++;
 	}
     }
-    AFREE(v2);	/* free copy of values of 2nd array */
+    set.clear();
+    TFREE(v2);	/* free copy of values of 2nd array */
 
     a3->size = v3 - a3->elts;
     if (a3->size == 0) {
@@ -1055,7 +1241,8 @@ Array *Array::setAdd(Dataspace *data, Array *a2)
     Value *v, *v1, *v2, *o;
     Value *v3;
     Array *a3;
-    unsigned short n;
+    ssizet n;
+    ValSet set;
 
     if (size == 0) {
 	/* ({ }) | array */
@@ -1073,17 +1260,17 @@ Array *Array::setAdd(Dataspace *data, Array *a2)
     }
 
     /* make room for elements to add */
-    v3 = ALLOCA(Value, a2->size);
+    v3 = TALLOC(Value, a2->size);
 
-    /* copy and sort values of 1st array */
-    copytmp(data, v1 = ALLOCA(Value, size), this);
-    std::qsort(v1, size, sizeof(Value), cmp);
+    /* copy values of 1st array to a set */
+    copytmp(data, v1 = TALLOC(Value, size), this);
+    set.init(v1, size);
 
     v = v3;
     v2 = Dataspace::elts(a2);
     if (a2->objDestrCount == ::objDestrCount) {
 	for (n = a2->size; n > 0; --n) {
-	    if (search(v2, v1, size, 1, FALSE) < 0) {
+	    if (!set.member(v2)) {
 		/*
 		 * element is only in second array: copy to result array
 		 */
@@ -1110,7 +1297,7 @@ Array *Array::setAdd(Dataspace *data, Array *a2)
 		}
 		break;
 	    }
-	    if (search(v2, v1, size, 1, FALSE) < 0) {
+	    if (!set.member(v2)) {
 		/*
 		 * element is only in second array: copy to result array
 		 */
@@ -1119,18 +1306,19 @@ Array *Array::setAdd(Dataspace *data, Array *a2)
 	    v2++;
 	}
     }
-    AFREE(v1);	/* free copy of values of 1st array */
+    set.clear();
+    TFREE(v1);	/* free copy of values of 1st array */
 
     n = v - v3;
-    if ((LPCint) size + n > max_size) {
-	AFREE(v3);
+    if ((Uint) size + n > (Uint) max_size) {
+	TFREE(v3);
 	EC->error("Array too large");
     }
 
     a3 = create(data, (LPCint) size + n);
     Value::copy(a3->elts, elts, size);
     Value::copy(a3->elts + size, v3, n);
-    AFREE(v3);
+    TFREE(v3);
 
     Dataspace::refImports(a3);
     return a3;
@@ -1144,8 +1332,9 @@ Array *Array::setXAdd(Dataspace *data, Array *a2)
     Value *v, *w, *v1, *v2;
     Value *v3;
     Array *a3;
-    unsigned short n, sz;
-    unsigned short num;
+    ssizet n, sz;
+    ssizet num;
+    ValSet set;
 
     if (size == 0) {
 	/* ({ }) ^ array */
@@ -1163,19 +1352,19 @@ Array *Array::setXAdd(Dataspace *data, Array *a2)
     }
 
     /* copy values of 1st array */
-    copytmp(data, v1 = ALLOCA(Value, size), this);
+    copytmp(data, v1 = TALLOC(Value, size), this);
 
-    /* copy and sort values of 2nd array */
-    copytmp(data, v2 = ALLOCA(Value, a2->size), a2);
-    std::qsort(v2, a2->size, sizeof(Value), cmp);
+    /* copy values of 2nd array to a set */
+    copytmp(data, v2 = TALLOC(Value, a2->size), a2);
+    set.init(v2, a2->size);
 
     /* room for first half of result */
-    v3 = ALLOCA(Value, size);
+    v3 = TALLOC(Value, size);
 
     v = v3;
     w = v1;
     for (n = size; n > 0; --n) {
-	if (search(v1, v2, a2->size, 1, FALSE) < 0) {
+	if (!set.member(v1)) {
 	    /*
 	     * element is only in first array: copy to result array
 	     */
@@ -1189,15 +1378,16 @@ Array *Array::setXAdd(Dataspace *data, Array *a2)
 	v1++;
     }
     num = v - v3;
+    set.clear();
 
-    /* sort copy of 1st array */
+    /* remaining values of 1st array form a set */
     v1 -= size;
-    std::qsort(v1, sz = w - v1, sizeof(Value), cmp);
+    set.init(v1, sz = w - v1);
 
     v = v2;
     w = a2->elts;
     for (n = a2->size; n > 0; --n) {
-	if (search(w, v1, sz, 1, FALSE) < 0) {
+	if (!set.member(w)) {
 	    /*
 	     * element is only in second array: copy to 2nd result array
 	     */
@@ -1205,21 +1395,22 @@ Array *Array::setXAdd(Dataspace *data, Array *a2)
 	}
 	w++;
     }
+    set.clear();
 
     n = v - v2;
-    if ((LPCint) num + n > max_size) {
-	AFREE(v3);
-	AFREE(v2);
-	AFREE(v1);
+    if ((Uint) num + n > (Uint) max_size) {
+	TFREE(v3);
+	TFREE(v2);
+	TFREE(v1);
 	EC->error("Array too large");
     }
 
     a3 = create(data, (LPCint) num + n);
     Value::copy(a3->elts, v3, num);
     Value::copy(a3->elts + num, v2, n);
-    AFREE(v3);
-    AFREE(v2);
-    AFREE(v1);
+    TFREE(v3);
+    TFREE(v2);
+    TFREE(v1);
 
     Dataspace::refImports(a3);
     return a3;
@@ -1228,7 +1419,7 @@ Array *Array::setXAdd(Dataspace *data, Array *a2)
 /*
  * index an array
  */
-unsigned short Array::index(LPCint l)
+ssizet Array::index(LPCint l)
 {
     if (l < 0 || l >= (LPCint) size) {
 	EC->error("Array index out of range");
@@ -1259,13 +1450,13 @@ Array *Array::range(Dataspace *data, LPCint l1, LPCint l2)
 
     range = create(data, l2 - l1 + 1);
     Value::copy(range->elts, Dataspace::elts(this) + l1,
-		(unsigned short) (l2 - l1 + 1));
+		(ssizet) (l2 - l1 + 1));
     Dataspace::refImports(range);
     return range;
 }
 
 
-Mapping::Mapping(unsigned short size)
+Mapping::Mapping(ssizet size)
     : Array(size)
 {
     hashmod = FALSE;
@@ -1304,7 +1495,7 @@ void Mapping::shallowDelete()
 /*
  * allocate a new mapping
  */
-Mapping *Mapping::alloc(unsigned short size)
+Mapping *Mapping::alloc(ssizet size)
 {
     return chunknew (mchunk) Mapping(size);
 }
@@ -1319,7 +1510,7 @@ Mapping *Mapping::create(Dataspace *data, LPCint size)
     if (size > max_size << 1) {
 	EC->error("Mapping too large");
     }
-    m = alloc((unsigned short) size);
+    m = alloc((ssizet) size);
     if (size > 0) {
 	m->elts = ALLOC(Value, size);
     }
@@ -1338,7 +1529,7 @@ Mapping *Mapping::create(Dataspace *data, LPCint size)
  */
 void Mapping::sort()
 {
-    unsigned short i, sz;
+    ssizet i, sz;
     Value *v, *w;
 
     for (i = size, sz = 0, v = w = elts; i > 0; i -= 2) {
@@ -1374,7 +1565,7 @@ void Mapping::sort()
  */
 void Mapping::dehash(Dataspace *data, bool clean)
 {
-    unsigned short sz, i, j;
+    ssizet sz, i, j, n, m, h;
     Value *v1, *v2, *v3;
 
     if (clean && size != 0) {
@@ -1453,7 +1644,7 @@ void Mapping::dehash(Dataspace *data, bool clean)
 	 * merge copy of hashtable with sorted array
 	 */
 	j = hashed->size;
-	v2 = ALLOCA(Value, j << 1);
+	v2 = TALLOC(Value, j << 1);
 	sz = hashed->collect(v2, (clean) ? this : (Array *) NULL, data);
 
 	if (j != hashed->size) {
@@ -1466,39 +1657,37 @@ void Mapping::dehash(Dataspace *data, bool clean)
 	    sz <<= 1;
 
 	    /*
-	     * merge the two value arrays
+	     * Merge the new elements into the array part, from the end.
+	     * Each new element is placed with a binary search, and the
+	     * values in between are moved as a block.
 	     */
-	    v1 = elts;
-	    v3 = ALLOC(Value, size + sz);
-	    for (i = size, j = sz; i > 0 && j > 0; ) {
-		if (cmp(v1, v2) <= 0) {
-		    *v3++ = *v1++;
-		    *v3++ = *v1++;
-		    i -= 2;
-		} else {
-		    *v3++ = *v2++;
-		    *v3++ = *v2++;
-		    j -= 2;
+	    elts = REALLOC(elts, Value, size, size + sz);
+	    v1 = elts + size + sz;
+	    for (i = size, j = sz; j > 0; j -= 2) {
+		/*
+		 * place after all elements that do not sort after it,
+		 * including arrays with an identical tag
+		 */
+		n = 0;
+		h = i;
+		while (n < h) {
+		    m = ((n + h) >> 1) & ~1;
+		    if (cmp(&v2[j - 2], elts + m) < 0) {
+			h = m;
+		    } else {
+			n = m + 2;
+		    }
 		}
-	    }
-
-	    /*
-	     * copy tails of arrays
-	     */
-	    memcpy(v3, v1, i * sizeof(Value));
-	    v3 += i;
-	    memcpy(v3, v2, j * sizeof(Value));
-	    v3 += j;
-
-	    v2 -= (sz - j);
-	    if (size > 0) {
-		FREE(elts);
+		v1 -= i - n;
+		memmove(v1, elts + n, (i - n) * sizeof(Value));
+		i = n;
+		*--v1 = v2[j - 1];
+		*--v1 = v2[j - 2];
 	    }
 	    size += sz;
-	    elts = v3 - size;
 	}
 
-	AFREE(v2);
+	TFREE(v2);
     }
 }
 
@@ -1524,7 +1713,7 @@ bool Mapping::trim()
  */
 void Mapping::compact(Dataspace *data)
 {
-    if (hashmod || objDestrCount != ::objDestrCount) {
+    if (objDestrCount != ::objDestrCount) {
 	if (hashmod && (!THISPLANE(primary) || !SAMEPLANE(data, primary->data)))
 	{
 	    dehash(data, FALSE);
@@ -1532,6 +1721,9 @@ void Mapping::compact(Dataspace *data)
 
 	dehash(data, TRUE);
 	objDestrCount = ::objDestrCount;
+    } else if (hashmod) {
+	/* no objects were destructed, so there is nothing to clean */
+	dehash(data, FALSE);
     }
 }
 
@@ -1548,19 +1740,31 @@ void Mapping::canonicalize()
 /*
  * return the size of a mapping
  */
-unsigned short Mapping::msize(Dataspace *data)
+ssizet Mapping::msize(Dataspace *data)
 {
     compact(data);
     return size >> 1;
 }
 
+/*
+ * return the number of elements in a mapping, without merging new elements
+ * into the array part
+ */
+ssizet Mapping::count(Dataspace *data)
+{
+    if (objDestrCount != ::objDestrCount) {
+	compact(data);
+    }
+    return (size >> 1) + ((hashmod) ? hashed->sizemod : 0);
+}
+
 /*
  * add two mappings
  */
 Array *Mapping::add(Dataspace *data, Array *a2)
 {
     Value *v1, *v2, *v3;
-    unsigned short n1, n2;
+    ssizet n1, n2;
     int c;
     Mapping *m2, *m3;
 
@@ -1590,7 +1794,7 @@ Array *Mapping::add(Dataspace *data, Array *a2)
 		/* equal elements? */
 		if (T_INDEXED(v1->type) && v1->array != v2->array) {
 		    Value *v;
-		    unsigned short n;
+		    ssizet n;
 
 		    /*
 		     * The array tags are the same, but the arrays are not.
@@ -1643,7 +1847,7 @@ Array *Mapping::add(Dataspace *data, Array *a2)
 Array *Mapping::sub(Dataspace *data, Array *a2)
 {
     Value *v1, *v2, *v3;
-    unsigned short n1, n2;
+    ssizet n1, n2;
     int c;
     Mapping *m3;
 
@@ -1661,7 +1865,7 @@ Array *Mapping::sub(Dataspace *data, Array *a2)
     }
 
     /* copy and sort values of array */
-    copytmp(data, v2 = ALLOCA(Value, a2->size), a2);
+    copytmp(data, v2 = TALLOC(Value, a2->size), a2);
     std::qsort(v2, a2->size, sizeof(Value), cmp);
 
     v1 = elts;
@@ -1679,7 +1883,7 @@ Array *Mapping::sub(Dataspace *data, Array *a2)
 	    /* equal elements? */
 	    if (T_INDEXED(v1->type) && v1->array != v2->array) {
 		Value *v;
-		unsigned short n;
+		ssizet n;
 
 		/*
 		 * The array tags are the same, but the arrays are not.
@@ -1706,7 +1910,7 @@ Array *Mapping::sub(Dataspace *data, Array *a2)
 	    v1 += 2; n1 -= 2;
 	}
     }
-    AFREE(v2 - (a2->size - n2));
+    TFREE(v2 - (a2->size - n2));
 
     /* copy tail part of mapping */
     Value::copy(v3, v1, n1);
@@ -1728,7 +1932,7 @@ Array *Mapping::sub(Dataspace *data, Array *a2)
 Array *Mapping::intersect(Dataspace *data, Array *a2)
 {
     Value *v1, *v2, *v3;
-    unsigned short n1, n2;
+    ssizet n1, n2;
     int c;
     Mapping *m3;
 
@@ -1744,7 +1948,7 @@ Array *Mapping::intersect(Dataspace *data, Array *a2)
     }
 
     /* copy and sort values of array */
-    copytmp(data, v2 = ALLOCA(Value, a2->size), a2);
+    copytmp(data, v2 = TALLOC(Value, a2->size), a2);
     std::qsort(v2, a2->size, sizeof(Value), cmp);
 
     v1 = elts;
@@ -1761,7 +1965,7 @@ Array *Mapping::intersect(Dataspace *data, Array *a2)
 	    /* equal elements? */
 	    if (T_INDEXED(v1->type) && v1->array != v2->array) {
 		Value *v;
-		unsigned short n;
+		ssizet n;
 
 		/*
 		 * The array tags are the same, but the arrays are not.
@@ -1791,7 +1995,7 @@ Array *Mapping::intersect(Dataspace *data, Array *a2)
 	    v2++; --n2;
 	}
     }
-    AFREE(v2 - (a2->size - n2));
+    TFREE(v2 - (a2->size - n2));
 
     m3->size = v3 - m3->elts;
     if (m3->size == 0) {
@@ -1809,11 +2013,12 @@ Array *Mapping::intersect(Dataspace *data, Array *a2)
  */
 Value *Mapping::index(Dataspace *data, Value *val, Value *elt, Value *verify)
 {
+    uint64_t h;
     Uint i;
     MapElt *e, **p;
     bool del, add, hash;
 
-    i = 0;
+    h = 0;
 
     if (elt != (Value *) NULL && VAL_NIL(elt)) {
 	elt = (Value *) NULL;
@@ -1828,31 +2033,32 @@ Value *Mapping::index(Dataspace *data, Value *val, Value *elt, Value *verify)
 
     switch (val->type) {
     case T_NIL:
-	i = 4747;
+	h = 4747;
 	break;
 
     case T_INT:
-	i = val->number;
+	h = val->number;
 	break;
 
     case T_FLOAT:
-	i = VFLT_HASH(val);
+	h = VFLT_HASH(val);
 	break;
 
     case T_STRING:
-	i = HM->hashstr(val->string->text, STRMAPHASHSZ) ^ val->string->len;
+	h = HM->hashmem64(val->string->text, val->string->len);
 	break;
 
     case T_OBJECT:
-	i = val->oindex;
+	h = val->oindex;
 	break;
 
     case T_ARRAY:
     case T_MAPPING:
     case T_LWOBJECT:
-	i = (unsigned short) ((uintptr_t) val->array >> 3);
+	h = (uintptr_t) val->array;
 	break;
     }
+    i = (Uint) ((h * 0x9e3779b97f4a7c15ULL) >> 32);
 
     hash = FALSE;
     if (hashed != (MapHash *) NULL) {
@@ -1960,10 +2166,10 @@ Value *Mapping::index(Dataspace *data, Value *val, Value *elt, Value *verify)
 	 * extend mapping
 	 */
 	if (add &&
-	    (size >> 1) + ((hashed == (MapHash *) NULL) ?
-					    0 : hashed->sizemod) >= max_size) {
+	    (Uint) (size >> 1) + ((hashed == (MapHash *) NULL) ?
+				       0 : hashed->sizemod) >= (Uint) max_size) {
 	    compact(data);
-	    if (size >> 1 >= max_size) {
+	    if ((LPCint) (size >> 1) >= max_size) {
 		EC->error("Mapping too large to grow");
 	    }
 	}
@@ -1973,19 +2179,19 @@ Value *Mapping::index(Dataspace *data, Value *val, Value *elt, Value *verify)
 	     * add hash table to this mapping
 	     */
 	    hashed = chunknew (mhchunk) MapHash;
-	} else if (size << 2 >= hashed->tablesize * 3) {
+	} else if (hashed->size >= (hashed->tablesize >> 3) * 3) {
 	    /*
-	     * extend hash table for this mapping
+	     * extend hash table for this mapping, which can hold more elements
+	     * than the array part
 	     */
 	    hashed->grow();
 	}
 	e = hashed->add(i);
 
 	if (add) {
-	    e->add = TRUE;
+	    hashed->mark(e);
 	    data->assignElt(this, &e->idx, val);
 	    data->assignElt(this, &e->val, elt);
-	    hashed->sizemod++;
 	    hashmod = TRUE;
 	    Dataspace::changeMap(this);
 	} else {
@@ -2002,7 +2208,7 @@ Value *Mapping::index(Dataspace *data, Value *val, Value *elt, Value *verify)
  */
 Mapping *Mapping::range(Dataspace *data, Value *v1, Value *v2)
 {
-    unsigned short from, to;
+    ssizet from, to;
     Mapping *range;
 
     compact(data);
@@ -2040,7 +2246,7 @@ Array *Mapping::indices(Dataspace *data)
 {
     Array *indices;
     Value *v1, *v2;
-    unsigned short n;
+    ssizet n;
 
     compact(data);
     indices = Array::create(data, n = size >> 1);
@@ -2061,7 +2267,7 @@ Array *Mapping::values(Dataspace *data)
 {
     Array *values;
     Value *v1, *v2;
-    unsigned short n;
+    ssizet n;
 
     compact(data);
     values = Array::create(data, n = size >> 1);
@@ -2079,7 +2285,7 @@ Array *Mapping::values(Dataspace *data)
 /*
  * allocate a new light-weight object
  */
-LWO *LWO::alloc(unsigned short size)
+LWO *LWO::alloc(ssizet size)
 {
     return chunknew (ochunk) LWO(size);
 }
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2022 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -21,7 +21,7 @@ class Array : public ChunkAllocated {
 public:
     class Backup;			/* array backup chunk */
 
-    Array(unsigned short size);
+    Array(ssizet size);
     Array() {
 	prev = next = this;		/* alist sentinel */
     }
@@ -41,12 +41,12 @@ public:
     virtual Array *intersect(Dataspace *data, Array *a2);
     Array *setAdd(Dataspace *data, Array *a2);
     Array *setXAdd(Dataspace *data, Array *a2);
-    unsigned short index(LPCint l);
+    ssizet index(LPCint l);
     void checkRange(LPCint l1, LPCint l2);
     Array *range(Dataspace *data, LPCint l1, LPCint l2);
 
     static void init(unsigned int size);
-    static Array *alloc(unsigned short size);
+    static Array *alloc(ssizet size);
     static Array *create(Dataspace *data, LPCint size);
     static Array *createNil(Dataspace *data, LPCint size);
     static void freeall();
@@ -55,7 +55,7 @@ public:
     static void commit(Backup **ac, Dataplane *plane, bool merge);
     static void discard(Backup **ac);
 
-    unsigned short size;		/* number of elements */
+    ssizet size;			/* number of elements */
     Uint refCount;			/* number of references */
     Uint tag;				/* used in sorting */
     Uint objDestrCount;			/* last destructed object count */
@@ -72,13 +72,14 @@ protected:
 
 class Mapping : public Array {
 public:
-    Mapping(unsigned short size);
+    Mapping(ssizet size);
     virtual ~Mapping() { }
 
     void sort();
     virtual bool trim();
     virtual void canonicalize();
-    unsigned short msize(Dataspace *data);
+    ssizet msize(Dataspace *data);
+    ssizet count(Dataspace *data);
     virtual Array *add(Dataspace *data, Array *a2);
     virtual Array *sub(Dataspace *data, Array *a2);
     virtual Array *intersect(Dataspace *data, Array *a2);
@@ -87,7 +88,7 @@ public:
     Array *indices(Dataspace *data);
     Array *values(Dataspace *data);
 
-    static Mapping *alloc(unsigned short size);
+    static Mapping *alloc(ssizet size);
     static Mapping *create(Dataspace *data, LPCint size);
 
 protected:
@@ -106,11 +107,11 @@ private:
 
 class LWO : public Array {
 public:
-    LWO(unsigned short size) : Array(size) { }
+    LWO(ssizet size) : Array(size) { }
     virtual ~LWO() { }
 
     LWO *copy(Dataspace *data);
 
-    static LWO *alloc(unsigned short size);
+    static LWO *alloc(ssizet size);
     static LWO *create(Dataspace *data, Object *obj);
 };
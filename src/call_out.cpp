@@ -27,24 +27,32 @@
 # include "interpret.h"
 # include "call_out.h"
 
-# define CYCBUF_SIZE	128		/* cyclic buffer size, power of 2 */
-# define CYCBUF_MASK	(CYCBUF_SIZE - 1) /* cyclic buffer mask */
+# define WHEEL_BITS	7		/* bits per timing wheel level */
+# define WHEEL_SIZE	(1 << WHEEL_BITS) /* slots per level */
+# define WHEEL_MASK	(WHEEL_SIZE - 1) /* timing wheel slot mask */
+# define WHEEL_LEVELS	6		/* levels, covering 42 bits of time */
+# define WHEEL_MAP	(WHEEL_SIZE / 32) /* slot bitmap size */
 # define SWPERIOD	60		/* swaprate buffer size */
 
-# define last		prev
+# define CO_IMMEDIATE	0		/* time of immediate callout */
+# define CO_RUNNING	1		/* time of running callout */
+
+# define COHASH(o, h)	(((Uint) (o) * 257 + (h)) % cotabsz)
 
 static CallOut *cotab;			/* callout table */
+static cindex *cohtab;			/* callout hash table */
 static cindex cotabsz;			/* callout table size */
-static cindex queuebrk;			/* queue brk */
-static cindex cycbrk;			/* cyclic buffer brk */
+static cindex cobrk;			/* callout table brk */
 static cindex flist;			/* free list index */
-static cindex nzero;			/* # immediate callouts */
-static cindex nshort;			/* # short-term callouts, incl. nzero */
+static cindex nzero;			/* # immediate and running callouts */
+static cindex nwheel;			/* # callouts in the timing wheel */
 static cindex running;			/* running callouts */
 static cindex immediate;		/* immediate callouts */
-static cindex cycbuf[CYCBUF_SIZE];	/* cyclic buffer of callout lists */
-static Uint timestamp;			/* cycbuf start time */
-static Uint timeout;			/* time of first callout in cycbuf */
+static cindex wheel[WHEEL_LEVELS][WHEEL_SIZE]; /* timing wheel */
+static Uint wmap[WHEEL_LEVELS][WHEEL_MAP]; /* occupied timing wheel slots */
+static cindex wcount[WHEEL_LEVELS];	/* # callouts per timing wheel level */
+static Time wtime;			/* timing wheel time in milliseconds */
+static Uint timestamp;			/* time the last alarm came */
 static Uint timediff;			/* stored/actual time difference */
 static Uint cotime;			/* callout time */
 static unsigned short comtime;		/* callout millisecond time */
@@ -61,18 +69,21 @@ bool CallOut::init(unsigned int max)
 {
     if (max != 0) {
 	/* only if callouts are enabled */
-	cotab = ALLOC(CallOut, max + 1);
-	cotab[0].time = 0;	/* sentinel for the heap */
-	cotab++;
+	cotab = ALLOC(CallOut, max + 1);	/* index 0 is not used */
+	cohtab = ALLOC(cindex, max);
+	memset(cohtab, '\0', max * sizeof(cindex));
 	flist = 0;
-	timestamp = timeout = 0;
+	timestamp = 0;
 	timediff = 0;
     }
     running = immediate = 0;
-    memset(cycbuf, '\0', sizeof(cycbuf));
-    cycbrk = cotabsz = max;
-    queuebrk = 0;
-    nzero = nshort = 0;
+    memset(wheel, '\0', sizeof(wheel));
+    memset(wmap, '\0', sizeof(wmap));
+    memset(wcount, '\0', sizeof(wcount));
+    wtime = 0;
+    cotabsz = max;
+    cobrk = 1;
+    nzero = nwheel = 0;
     ::cotime = 0;
 
     swaptime = P_time();
@@ -84,191 +95,188 @@ bool CallOut::init(unsigned int max)
 }
 
 /*
- * put a callout in the queue
+ * append a callout to a list
  */
-CallOut *CallOut::enqueue(Uint t, unsigned short m)
+void CallOut::link(cindex *list, cindex i)
 {
-    cindex i, j;
-    CallOut *l;
-    Time time;
+    CallOut *co, *first;
 
-    /*
-     * create a free spot in the heap, and sift it upward
-     */
-# ifdef DEBUG
-    if (queuebrk == cycbrk) {
-	EC->fatal("callout table overflow");
+    co = &cotab[i];
+    if (*list == 0) {
+	/* first one in list */
+	*list = co->prev = co->next = i;
+    } else {
+	first = &cotab[*list];
+	co->prev = first->prev;
+	co->next = *list;
+	cotab[first->prev].next = i;
+	first->prev = i;
     }
-# endif
-    i = ++queuebrk;
-    l = cotab - 1;
-    time = ((Time) t << 16) | m;
-    for (j = i >> 1; l[j].time > time; i = j, j >>= 1) {
-	l[i] = l[j];
+}
+
+/*
+ * remove a callout from a list
+ */
+void CallOut::unlink(cindex *list, cindex i)
+{
+    CallOut *co;
+
+    co = &cotab[i];
+    if (co->next == i) {
+	/* last one in list */
+	*list = 0;
+    } else {
+	cotab[co->prev].next = co->next;
+	cotab[co->next].prev = co->prev;
+	if (*list == i) {
+	    *list = co->next;
+	}
     }
+}
 
-    l = &l[i];
-    l->time = time;
+/*
+ * return the timing wheel level for a callout time
+ */
+int CallOut::level(Time t)
+{
+    int l;
+
+    for (t = (t ^ wtime) >> WHEEL_BITS, l = 0; t != 0; t >>= WHEEL_BITS) {
+	l++;
+    }
     return l;
 }
 
 /*
- * remove a callout from the queue
+ * put a callout in the timing wheel
+ */
+void CallOut::enqueue(cindex i)
+{
+    int l;
+    unsigned int s;
+
+    l = level(cotab[i].time);
+    s = (unsigned int) (cotab[i].time >> (l * WHEEL_BITS)) & WHEEL_MASK;
+    link(&wheel[l][s], i);
+    wmap[l][s >> 5] |= (Uint) 1 << (s & 31);
+    wcount[l]++;
+    nwheel++;
+}
+
+/*
+ * remove a callout from the timing wheel
  */
 void CallOut::dequeue(cindex i)
 {
-    Time t;
-    cindex j;
-    CallOut *l;
-
-    l = cotab - 1;
-    i++;
-    t = l[queuebrk].time;
-    if (t < l[i].time) {
-	/* sift upward */
-	for (j = i >> 1; l[j].time > t; i = j, j >>= 1) {
-	    l[i] = l[j];
-	}
-    } else if (i <= UINDEX_MAX / 2) {
-	/* sift downward */
-	for (j = i << 1; j < queuebrk; i = j, j <<= 1) {
-	    if (l[j].time > l[j + 1].time) {
-		j++;
-	    }
-	    if (t <= l[j].time) {
-		break;
-	    }
-	    l[i] = l[j];
-	}
+    int l;
+    unsigned int s;
+
+    l = level(cotab[i].time);
+    s = (unsigned int) (cotab[i].time >> (l * WHEEL_BITS)) & WHEEL_MASK;
+    unlink(&wheel[l][s], i);
+    if (wheel[l][s] == 0) {
+	wmap[l][s >> 5] &= ~((Uint) 1 << (s & 31));
     }
-    /* put into place */
-    l[i] = l[queuebrk--];
+    --wcount[l];
+    --nwheel;
 }
 
 /*
- * allocate a new callout for the cyclic buffer
+ * find the next occupied slot in the timing wheel, and return the time
+ * at which it starts
  */
-CallOut *CallOut::newcallout(cindex *list, Uint t)
+Time CallOut::nextslot(int *lp, unsigned int *sp)
 {
-    cindex i;
-    CallOut *co, *first, *last;
+    int l;
+    unsigned int s;
+    Uint bits;
+
+    /*
+     * All callouts at a level are in slots past the current one, so the
+     * first occupied slot of the lowest occupied level is the next one.
+     */
+    for (l = 0; wcount[l] == 0; l++) ;
+    for (s = 0; wmap[l][s] == 0; s++) ;
+    for (bits = wmap[l][s], s <<= 5; !(bits & 1); bits >>= 1) {
+	s++;
+    }
+
+    *lp = l;
+    *sp = s;
+    l *= WHEEL_BITS;
+    return (((wtime >> l) >> WHEEL_BITS) << (l + WHEEL_BITS)) |
+	   ((Time) s << l);
+}
+
+/*
+ * allocate a new callout
+ */
+cindex CallOut::newcallout(unsigned int oindex, unsigned int handle)
+{
+    cindex i, *h;
+    CallOut *co;
 
     if (flist != 0) {
 	/* get callout from free list */
 	i = flist;
-	flist = cotab[i].r.next;
+	flist = cotab[i].next;
     } else {
 	/* allocate new callout */
 # ifdef DEBUG
-	if (cycbrk == queuebrk || cycbrk == 1) {
+	if (cobrk > cotabsz) {
 	    EC->fatal("callout table overflow");
 	}
 # endif
-	i = --cycbrk;
-    }
-    nshort++;
-    if (t == 0) {
-	nzero++;
+	i = cobrk++;
     }
 
     co = &cotab[i];
-    if (*list == 0) {
-	/* first one in list */
-	*list = i;
-	co->r.count = 1;
-
-	if (t != 0 && (timeout == 0 || t < timeout)) {
-	    timeout = t;
-	}
-    } else {
-	/* add to list */
-	first = &cotab[*list];
-	last = (first->r.count == 1) ? first : &cotab[first->r.last];
-	last->r.next = i;
-	first->r.count++;
-	first->r.last = i;
-    }
-    co->r.prev = co->r.next = 0;
+    co->handle = handle;
+    co->oindex = oindex;
+    h = &cohtab[COHASH(oindex, handle)];
+    co->hnext = *h;
+    *h = i;
 
-    return co;
+    return i;
 }
 
 /*
- * remove a callout from the cyclic buffer
+ * free a callout
  */
-void CallOut::freecallout(cindex *cyc, cindex j, cindex i, Uint t)
+void CallOut::freecallout(cindex i)
 {
-    CallOut *l, *first;
+    cindex *h;
+    CallOut *co;
 
-    --nshort;
-    if (t == 0) {
-	--nzero;
-    }
+    co = &cotab[i];
+    for (h = &cohtab[COHASH(co->oindex, co->handle)]; *h != i;
+	 h = &cotab[*h].hnext) ;
+    *h = co->hnext;
 
-    l = cotab;
-    first = &l[*cyc];
-    if (i == j) {
-	if (first->r.count == 1) {
-	    *cyc = 0;
+    co->next = flist;
+    flist = i;
+}
 
-	    if (t != 0 && t == timeout) {
-		if (nshort != nzero) {
-		    while (cycbuf[t & CYCBUF_MASK] == 0) {
-			t++;
-		    }
-		    timeout = t;
-		} else {
-		    timeout = 0;
-		}
-	    }
-	} else {
-	    *cyc = first->r.next;
-	    l[first->r.next].r.count = first->r.count - 1;
-	    if (first->r.count != 2) {
-		l[first->r.next].r.last = first->r.last;
-	    }
-	}
-    } else {
-	--first->r.count;
-	if (i == first->r.last) {
-	    l[j].r.prev = l[j].r.next = 0;
-	    if (first->r.count != 1) {
-		first->r.last = j;
-	    }
-	} else {
-	    l[j].r.next = l[i].r.next;
-	}
-    }
+/*
+ * add a callout to a list, or to the timing wheel
+ */
+void CallOut::insert(unsigned int oindex, unsigned int handle, Time time,
+		     cindex *list)
+{
+    cindex i;
 
-    l += i;
-    l->handle = 0;	/* mark as unused */
-    if (i == cycbrk) {
-	/*
-	 * callout at the edge
-	 */
-	while (++cycbrk != cotabsz && (++l)->handle == 0) {
-	    /* followed by free callout */
-	    if (cycbrk == flist) {
-		/* first in the free list */
-		flist = l->r.next;
-	    } else {
-		/* connect previous to next */
-		cotab[l->r.prev].r.next = l->r.next;
-		if (l->r.next != 0) {
-		    /* connect next to previous */
-		    cotab[l->r.next].r.prev = l->r.prev;
-		}
-	    }
-	}
+    i = newcallout(oindex, handle);
+    if (list == (cindex *) NULL && time <= wtime) {
+	/* already expired */
+	time = CO_IMMEDIATE;
+	list = &immediate;
+    }
+    cotab[i].time = time;
+    if (list != (cindex *) NULL) {
+	link(list, i);
+	nzero++;
     } else {
-	/* add to free list */
-	if (flist != 0) {
-	    /* link next to current */
-	    cotab[flist].r.prev = i;
-	}
-	/* link to next */
-	l->r.next = flist;
-	flist = i;
+	enqueue(i);
     }
 }
 
@@ -277,7 +285,9 @@ void CallOut::freecallout(cindex *cyc, cindex j, cindex i, Uint t)
  */
 Uint CallOut::cotime(unsigned short *mtime)
 {
-    Uint t;
+    Uint t, timeout;
+    int l;
+    unsigned int s;
 
     if (::cotime != 0) {
 	*mtime = comtime;
@@ -291,6 +301,7 @@ Uint CallOut::cotime(unsigned short *mtime)
 	*mtime = 0;
     } else if (timestamp < t) {
 	if (running == 0) {
+	    timeout = (nwheel != 0) ? (Uint) (nextslot(&l, &s) / 1000) : 0;
 	    if (timeout == 0 || timeout > t) {
 		timestamp = t;
 	    } else if (timestamp < timeout) {
@@ -325,7 +336,7 @@ Uint CallOut::check(unsigned int n, LPCint delay, unsigned int mdelay, Uint *tp,
 	return 0;
     }
 
-    if (queuebrk + (cindex) n == cycbrk || cycbrk - (cindex) n == 1) {
+    if (nzero + nwheel + (cindex) n >= cotabsz) {
 	EC->error("Too many callouts");
     }
 
@@ -333,7 +344,7 @@ Uint CallOut::check(unsigned int n, LPCint delay, unsigned int mdelay, Uint *tp,
 	/*
 	 * immediate callout
 	 */
-	if (nshort == 0 && queuebrk == 0 && n == 0) {
+	if (nzero == 0 && nwheel == 0 && n == 0) {
 	    cotime(mp);	/* initialize timestamp */
 	}
 	*qp = &immediate;
@@ -358,13 +369,8 @@ Uint CallOut::check(unsigned int n, LPCint delay, unsigned int mdelay, Uint *tp,
 	    m = TIME_INT;
 	}
 
-	if (mdelay == TIME_INT && t < timestamp + CYCBUF_SIZE) {
-	    /* use cyclic buffer */
-	    *qp = &cycbuf[t & CYCBUF_MASK];
-	} else {
-	    /* use queue */
-	    *qp = (cindex *) NULL;
-	}
+	/* use timing wheel */
+	*qp = (cindex *) NULL;
 	*tp = t;
 	*mp = m;
     }
@@ -378,56 +384,18 @@ Uint CallOut::check(unsigned int n, LPCint delay, unsigned int mdelay, Uint *tp,
 void CallOut::create(unsigned int oindex, unsigned int handle, Uint t,
 		     unsigned int m, cindex *q)
 {
-    CallOut *co;
-
     if (q != (cindex *) NULL) {
-	co = newcallout(q, t);
+	insert(oindex, handle, CO_IMMEDIATE, q);
     } else {
 	if (m == TIME_INT) {
 	    m = 0;
 	}
-	co = enqueue(t, m);
-    }
-    co->handle = handle;
-    co->oindex = oindex;
-}
-
-/*
- * remove a short-term callout
- */
-bool CallOut::rmshort(cindex *cyc, uindex i, uindex handle, Uint t)
-{
-    cindex j, k;
-    CallOut *l;
-
-    k = *cyc;
-    if (k != 0) {
-	/*
-	 * this time-slot is in use
-	 */
-	l = cotab;
-	if (l[k].oindex == i && l[k].handle == handle) {
-	    /* first element in list */
-	    freecallout(cyc, k, k, t);
-	    return TRUE;
-	}
-	if (l[*cyc].r.count != 1) {
-	    /*
-	     * list contains more than 1 element
-	     */
-	    j = k;
-	    k = l[j].r.next;
-	    do {
-		if (l[k].oindex == i && l[k].handle == handle) {
-		    /* found it */
-		    freecallout(cyc, j, k, t);
-		    return TRUE;
-		}
-		j = k;
-	    } while ((k = l[j].r.next) != 0);
+	if (nwheel == 0 && wtime < (Time) timestamp * 1000) {
+	    /* move empty timing wheel forward */
+	    wtime = (Time) timestamp * 1000;
 	}
+	insert(oindex, handle, (Time) t * 1000 + m, (cindex *) NULL);
     }
-    return FALSE;
 }
 
 /*
@@ -466,47 +434,33 @@ LPCint CallOut::remaining(Uint t, unsigned short *m)
 /*
  * remove a callout
  */
-void CallOut::del(unsigned int oindex, unsigned int handle, Uint t,
-		  unsigned int m)
+void CallOut::del(unsigned int oindex, unsigned int handle)
 {
-    CallOut *l;
-
-    if (m == TIME_INT) {
-	/*
-	 * try to find the callout in the cyclic buffer
-	 */
-	if (t > timestamp && t < timestamp + CYCBUF_SIZE &&
-	    rmshort(&cycbuf[t & CYCBUF_MASK], oindex, handle, t)) {
-	    return;
-	}
-    }
-
-    if (t <= timestamp) {
-	/*
-	 * possible immediate callout
-	 */
-	if (rmshort(&immediate, oindex, handle, 0) ||
-	    rmshort(&running, oindex, handle, 0)) {
-	    return;
-	}
-    }
+    cindex i;
+    CallOut *co;
 
-    /*
-     * Not found in the cyclic buffer; it <must> be in the queue.
-     */
-    l = cotab;
-    for (;;) {
+    for (i = cohtab[COHASH(oindex, handle)]; ; i = co->hnext) {
 # ifdef DEBUG
-	if (l == cotab + queuebrk) {
+	if (i == 0) {
 	    EC->fatal("failed to remove callout");
 	}
 # endif
-	if (l->oindex == oindex && l->handle == handle) {
-	    dequeue(l - cotab);
-	    return;
+	co = &cotab[i];
+	if (co->oindex == oindex && co->handle == handle) {
+	    break;
 	}
-	l++;
     }
+
+    if (co->time == CO_IMMEDIATE) {
+	unlink(&immediate, i);
+	--nzero;
+    } else if (co->time == CO_RUNNING) {
+	unlink(&running, i);
+	--nzero;
+    } else {
+	dequeue(i);
+    }
+    freecallout(i);
 }
 
 /*
@@ -515,7 +469,7 @@ void CallOut::del(unsigned int oindex, unsigned int handle, Uint t,
 void CallOut::list(Array *a)
 {
     Value *v, *w;
-    unsigned short i;
+    ssizet i;
     Uint t;
     unsigned short m;
     Float flt1, flt2;
@@ -543,80 +497,72 @@ void CallOut::list(Array *a)
     }
 }
 
+/*
+ * announce that the objects in a list of callouts will be needed soon
+ */
+void CallOut::prefetch(cindex list)
+{
+    cindex i;
+
+    if ((i=list) != 0) {
+	do {
+	    OBJ(cotab[i].oindex)->prefetch();
+	    i = cotab[i].next;
+	} while (i != list);
+    }
+}
+
 /*
  * collect callouts to run next
  */
 void CallOut::expire()
 {
-    CallOut *co, *first, *last;
-    uindex handle, oindex;
-    cindex i, *cyc;
+    cindex i, j, first;
+    int l;
+    unsigned int s;
     Uint t;
     unsigned short m;
-    Time time;
+    Time time, start;
 
     t = P_mtime(&m) - timediff;
-    time = ((Time) t << 16) | m;
-    if ((timeout != 0 && timeout <= t) ||
-	(queuebrk != 0 && cotab[0].time <= time)) {
-	while (timestamp < t) {
-	    timestamp++;
-
+    time = (Time) t * 1000 + m;
+    if (nwheel != 0 && (start=nextslot(&l, &s)) <= time) {
+	do {
 	    /*
-	     * from queue
+	     * move the callouts in this slot to a lower level, or to the
+	     * list of immediate callouts
 	     */
-	    while (queuebrk != 0 && (Uint) (cotab[0].time >> 16) < timestamp) {
-		handle = cotab[0].handle;
-		oindex = cotab[0].oindex;
-		dequeue(0);
-		co = newcallout(&immediate, 0);
-		co->handle = handle;
-		co->oindex = oindex;
-	    }
-
-	    /*
-	     * from cyclic buffer list
-	     */
-	    cyc = &cycbuf[timestamp & CYCBUF_MASK];
-	    i = *cyc;
-	    if (i != 0) {
-		*cyc = 0;
-		if (immediate == 0) {
-		    immediate = i;
+	    wtime = start;
+	    first = i = wheel[l][s];
+	    wheel[l][s] = 0;
+	    wmap[l][s >> 5] &= ~((Uint) 1 << (s & 31));
+	    do {
+		j = cotab[i].next;
+		--wcount[l];
+		--nwheel;
+		if (cotab[i].time <= wtime) {
+		    cotab[i].time = CO_IMMEDIATE;
+		    link(&immediate, i);
+		    nzero++;
 		} else {
-		    first = &cotab[immediate];
-		    last = (first->r.count == 1) ?
-			    first : &cotab[first->r.last];
-		    last->r.next = i;
-		    first->r.count += cotab[i].r.count;
-		    first->r.last = (cotab[i].r.count == 1) ?
-				     i : cotab[i].r.last;
+		    enqueue(i);
 		}
-		nzero += cotab[i].r.count;
-	    }
-	}
-
-	/*
-	 * from queue
-	 */
-	while (queuebrk != 0 && cotab[0].time <= time) {
-	    handle = cotab[0].handle;
-	    oindex = cotab[0].oindex;
-	    dequeue(0);
-	    co = newcallout(&immediate, 0);
-	    co->handle = handle;
-	    co->oindex = oindex;
-	}
+		i = j;
+	    } while (i != first);
+	} while (nwheel != 0 && (start=nextslot(&l, &s)) <= time);
 
-	if (timeout <= timestamp) {
-	    if (nshort != nzero) {
-		for (t = timestamp; cycbuf[t & CYCBUF_MASK] == 0; t++) ;
-		timeout = t;
-	    } else {
-		timeout = 0;
-	    }
+	/* objects with callouts in the next second */
+	start = wtime + 1000;
+	if (((start ^ wtime) >> (2 * WHEEL_BITS)) == 0) {
+	    prefetch(wheel[1][(start >> WHEEL_BITS) & WHEEL_MASK]);
 	}
     }
+    if (wtime < time) {
+	wtime = time;
+    }
+    if (timestamp < t) {
+	timestamp = t;
+    }
 
     /* handle swaprate */
     while (swaptime < t) {
@@ -643,32 +589,37 @@ void CallOut::call(Frame *f)
 
     if (running == 0) {
 	expire();
-	running = immediate;
-	immediate = 0;
+	if ((i=running=immediate) != 0) {
+	    immediate = 0;
+	    do {
+		cotab[i].time = CO_RUNNING;
+		OBJ(cotab[i].oindex)->prefetch();
+		i = cotab[i].next;
+	    } while (i != running);
+	}
     }
 
-    if (running != 0) {
-	/*
-	 * callouts to do
-	 */
-	while ((i=running) != 0) {
-	    handle = cotab[i].handle;
-	    obj = OBJ(cotab[i].oindex);
-	    freecallout(&running, i, i, 0);
-
-	    try {
-		EC->push(DGD::errHandler);
-		str = obj->dataspace()->callOut(handle, f, &nargs);
-		if (f->call(obj, (LWO *) NULL, str->text, str->len, TRUE,
-			    nargs)) {
-		    /* function exists */
-		    (f->sp++)->del();
-		}
-		(f->sp++)->string->del();
-		EC->pop();
-	    } catch (const char*) { }
-	    DGD::endTask();
-	}
+    /*
+     * callouts to do
+     */
+    while ((i=running) != 0) {
+	handle = cotab[i].handle;
+	obj = OBJ(cotab[i].oindex);
+	unlink(&running, i);
+	--nzero;
+	freecallout(i);
+
+	try {
+	    EC->push(DGD::errHandler);
+	    str = obj->dataspace()->callOut(handle, f, &nargs);
+	    if (f->call(obj, (LWO *) NULL, str->text, str->len, TRUE, nargs)) {
+		/* function exists */
+		(f->sp++)->del();
+	    }
+	    (f->sp++)->string->del();
+	    EC->pop();
+	} catch (const char*) { }
+	DGD::endTask();
     }
 }
 
@@ -677,8 +628,9 @@ void CallOut::call(Frame *f)
  */
 void CallOut::info(cindex *n1, cindex *n2)
 {
-    *n1 = nshort;
-    *n2 = queuebrk;
+    /* short-term: due, or in the two lowest levels of the timing wheel */
+    *n1 = nzero + wcount[0] + wcount[1];
+    *n2 = nwheel - wcount[0] - wcount[1];
 }
 
 /*
@@ -688,13 +640,16 @@ Uint CallOut::delay(Uint rtime, unsigned short rmtime, unsigned short *mtime)
 {
     Uint t;
     unsigned short m;
+    int l;
+    unsigned int s;
+    Time time;
 
     if (nzero != 0) {
 	/* immediate */
 	*mtime = 0;
 	return 0;
     }
-    if ((rtime | timeout | queuebrk) == 0) {
+    if (rtime == 0 && nwheel == 0) {
 	/* infinite */
 	*mtime = 0xffff;
 	return 0;
@@ -702,18 +657,14 @@ Uint CallOut::delay(Uint rtime, unsigned short rmtime, unsigned short *mtime)
     if (rtime != 0) {
 	rtime -= timediff;
     }
-    if (timeout != 0 && (rtime == 0 || timeout <= rtime)) {
-	rtime = timeout;
-	rmtime = 0;
-    }
-    if (queuebrk != 0 &&
-	(rtime == 0 || cotab[0].time <= (((Time) rtime << 16) | rmtime))) {
-	rtime = cotab[0].time >> 16;
-	rmtime = cotab[0].time;
-    }
-    if (rtime != 0) {
-	rtime += timediff;
+    if (nwheel != 0) {
+	time = nextslot(&l, &s);
+	if (rtime == 0 || time < (Time) rtime * 1000 + rmtime) {
+	    rtime = (Uint) (time / 1000);
+	    rmtime = (unsigned short) (time % 1000);
+	}
     }
+    rtime += timediff;
 
     t = cotime(&m);
     ::cotime = 0;
@@ -769,7 +720,23 @@ struct CallOut0 {
 
 # define CO0_LAYOUT	"uuiuu"
 
-struct CallOutHeader {
+struct CallOut1 {
+    union {
+	Time time;		/* when to call */
+	struct {
+	    cindex count;	/* # in list */
+	    cindex prev;	/* previous in list */
+	    cindex next;	/* next in list */
+	} r;
+    };
+    uindex handle;		/* callout handle */
+    uindex oindex;		/* index in object table */
+};
+
+# define CO1Q_LAYOUT	"[l|fff]uu"
+# define CO1C_LAYOUT	"[fff|l]uu"
+
+struct CallOutHeader1 {
     cindex cotabsz;		/* callout table size */
     cindex queuebrk;		/* queue brk */
     cindex cycbrk;		/* cyclic buffer brk */
@@ -783,7 +750,30 @@ struct CallOutHeader {
     Uint timediff;		/* accumulated time difference */
 };
 
-static char dh_layout[] = "fffffffssii";
+static char dh1_layout[] = "fffffffssii";
+
+# define CYCBUF_SIZE	128		/* cyclic buffer size, power of 2 */
+# define CYCBUF_MASK	(CYCBUF_SIZE - 1) /* cyclic buffer mask */
+
+struct CallOut2 {
+    Time time;			/* when to call */
+    uindex handle;		/* callout handle */
+    uindex oindex;		/* index in object table */
+};
+
+# define CO2_LAYOUT	"luu"
+
+struct CallOutHeader {
+    cindex cotabsz;		/* callout table size */
+    cindex nrunning;		/* # running callouts */
+    cindex nimmediate;		/* # immediate callouts */
+    cindex nwheel;		/* # callouts in the timing wheel */
+    Uint timestamp;		/* time the last alarm came */
+    Uint timediff;		/* accumulated time difference */
+    Time wtime;			/* timing wheel time */
+};
+
+static char dh_layout[] = "ffffiil";
 
 /*
  * dump callout table
@@ -791,126 +781,182 @@ static char dh_layout[] = "fffffffssii";
 bool CallOut::save(int fd)
 {
     CallOutHeader dh;
+    CallOut2 *co2, *co;
+    cindex n, i, list;
     unsigned short m;
+    bool flag;
 
     /* update timestamp */
     cotime(&m);
     ::cotime = 0;
 
+    /*
+     * collect callouts: running, immediate, and the timing wheel in
+     * order of level and slot
+     */
+    n = nzero + nwheel;
+    co2 = co = (n != 0) ? ALLOC(CallOut2, n) : (CallOut2 *) NULL;
+    for (n = 0; n < 2 + WHEEL_LEVELS * WHEEL_SIZE; n++) {
+	switch (n) {
+	case 0:
+	    list = running;
+	    break;
+
+	case 1:
+	    dh.nrunning = co - co2;
+	    list = immediate;
+	    break;
+
+	case 2:
+	    dh.nimmediate = co - co2 - dh.nrunning;
+	    /* fall through */
+	default:
+	    list = wheel[(n - 2) >> WHEEL_BITS][(n - 2) & WHEEL_MASK];
+	    break;
+	}
+	if ((i=list) != 0) {
+	    do {
+		co->time = cotab[i].time;
+		co->handle = cotab[i].handle;
+		co->oindex = cotab[i].oindex;
+		co++;
+		i = cotab[i].next;
+	    } while (i != list);
+	}
+    }
+
     /* fill in header */
     dh.cotabsz = cotabsz;
-    dh.queuebrk = queuebrk;
-    dh.cycbrk = cycbrk;
-    dh.flist = flist;
-    dh.nshort = nshort;
-    dh.running = running;
-    dh.immediate = immediate;
-    dh.hstamp = 0;
-    dh.hdiff = 0;
+    dh.nwheel = nwheel;
     dh.timestamp = timestamp;
     dh.timediff = timediff;
+    dh.wtime = wtime;
 
     /* write header and callouts */
-    return (Swap::write(fd, &dh, sizeof(CallOutHeader)) &&
-	    (queuebrk == 0 ||
-	     Swap::write(fd, cotab, queuebrk * sizeof(CallOut))) &&
-	    (cycbrk == cotabsz ||
-	     Swap::write(fd, cotab + cycbrk,
-			 (cotabsz - cycbrk) * sizeof(CallOut))) &&
-	    Swap::write(fd, cycbuf, CYCBUF_SIZE * sizeof(cindex)));
+    n = co - co2;
+    flag = (Swap::write(fd, &dh, sizeof(CallOutHeader)) &&
+	    (n == 0 || Swap::write(fd, co2, n * sizeof(CallOut2))));
+    if (co2 != (CallOut2 *) NULL) {
+	FREE(co2);
+    }
+    return flag;
 }
 
 /*
- * restore callout table
+ * restore a callout table with a cyclic buffer and a queue
  */
-void CallOut::restore(int fd, Uint t, bool conv16)
+void CallOut::restore1(int fd, Uint t, bool conv16)
 {
-    CallOutHeader dh;
-    cindex n, i, offset;
-    CallOut *co;
-    cindex *cb;
+    CallOutHeader1 dh;
+    cindex n, nq, i, k;
+    CallOut1 *co1, *co;
+    cindex cycbuf[CYCBUF_SIZE];
 
     /* read and check header */
-    timediff = t;
-
-    Config::dread(fd, (char *) &dh, dh_layout, (Uint) 1);
-    queuebrk = dh.queuebrk;
-    offset = cotabsz - dh.cotabsz;
-    cycbrk = dh.cycbrk + offset;
-    flist = dh.flist;
-    nshort = dh.nshort;
-    running = dh.running;
-    immediate = dh.immediate;
+    Config::dread(fd, (char *) &dh, dh1_layout, (Uint) 1);
     timestamp = dh.timestamp;
+    timediff = t - timestamp;
+    wtime = (Time) timestamp * 1000;
 
-    timediff -= timestamp;
-    if (queuebrk > cycbrk || cycbrk == 0) {
+    nq = dh.queuebrk;
+    n = nq + dh.cotabsz - dh.cycbrk;
+    if (nq > dh.cycbrk || dh.cycbrk == 0 || n > cotabsz) {
 	EC->error("Restored too many callouts");
     }
 
     /* read tables */
-    n = queuebrk + cotabsz - cycbrk;
+    co1 = (CallOut1 *) NULL;
     if (n != 0) {
+	co1 = ALLOC(CallOut1, n);
 	if (conv16) {
 	    CallOut0 *co0;
 
 	    co0 = ALLOC(CallOut0, n);
 	    Config::dread(fd, (char *) co0, CO0_LAYOUT, (Uint) n);
-	    for (i = 0; i < queuebrk; co0++, i++) {
-		cotab[i].time = (((Time) co0->htime) << 48) |
-				(((Time) co0->time) << 16) | co0->mtime;
-		cotab[i].handle = co0->handle;
-		cotab[i].oindex = co0->oindex;
-	    }
-	    for (i = cycbrk; i < cotabsz; co0++, i++) {
-		cotab[i].r.count = co0->time;
-		cotab[i].r.prev = co0->htime;
-		cotab[i].r.next = co0->mtime;
-		cotab[i].handle = co0->handle;
-		cotab[i].oindex = co0->oindex;
+	    for (i = 0; i < n; i++) {
+		if (i < nq) {
+		    co1[i].time = (((Time) co0[i].htime) << 48) |
+				  (((Time) co0[i].time) << 16) | co0[i].mtime;
+		} else {
+		    co1[i].r.count = co0[i].time;
+		    co1[i].r.prev = co0[i].htime;
+		    co1[i].r.next = co0[i].mtime;
+		}
+		co1[i].handle = co0[i].handle;
+		co1[i].oindex = co0[i].oindex;
 	    }
-	    FREE(co0 - queuebrk - cotabsz + cycbrk);
+	    FREE(co0);
 	} else {
-	    Config::dread(fd, (char *) cotab, CO1_LAYOUT, (Uint) queuebrk);
-	    Config::dread(fd, (char *) (cotab + cycbrk), CO2_LAYOUT,
-			  (Uint) (cotabsz - cycbrk));
+	    Config::dread(fd, (char *) co1, CO1Q_LAYOUT, (Uint) nq);
+	    Config::dread(fd, (char *) (co1 + nq), CO1C_LAYOUT, (Uint) (n - nq));
 	}
     }
     Config::dread(fd, (char *) cycbuf, "f", (Uint) CYCBUF_SIZE);
 
-    nzero = 0;
-    if (running != 0) {
-	running += offset;
-	nzero += cotab[running].r.count;
+    /*
+     * Lists are indexed from the start of the cyclic buffer area.  A list
+     * in the cyclic buffer slot for second t was due at that time.
+     */
+    co = co1 + nq - dh.cycbrk;
+    for (i = dh.running; i != 0; i = co[i].r.next) {
+	insert(co[i].oindex, co[i].handle, CO_RUNNING, &running);
     }
-    if (immediate != 0) {
-	immediate += offset;
-	nzero += cotab[immediate].r.count;
+    for (i = dh.immediate; i != 0; i = co[i].r.next) {
+	insert(co[i].oindex, co[i].handle, CO_IMMEDIATE, &immediate);
     }
-
-    if (offset != 0) {
-	/* patch callout references */
-	if (flist != 0) {
-	    flist += offset;
-	}
-	for (i = CYCBUF_SIZE, cb = cycbuf; i > 0; --i, cb++) {
-	    if (*cb != 0) {
-		*cb += offset;
-	    }
-	}
-	for (i = cotabsz - cycbrk, co = cotab + cycbrk; i > 0; --i, co++) {
-	    if (co->r.prev != 0) {
-		co->r.prev += offset;
-	    }
-	    if (co->r.next != 0) {
-		co->r.next += offset;
-	    }
+    for (k = 1; k <= CYCBUF_SIZE; k++) {
+	for (i = cycbuf[(timestamp + k) & CYCBUF_MASK]; i != 0;
+	     i = co[i].r.next) {
+	    insert(co[i].oindex, co[i].handle, (Time) (timestamp + k) * 1000,
+		   (cindex *) NULL);
 	}
     }
+    for (i = 0; i < nq; i++) {
+	insert(co1[i].oindex, co1[i].handle,
+	       (co1[i].time >> 16) * 1000 + (co1[i].time & 0xffff),
+	       (cindex *) NULL);
+    }
 
-    /* restart callouts */
-    if (nshort != nzero) {
-	for (t = timestamp; cycbuf[t & CYCBUF_MASK] == 0; t++) ;
-	timeout = t;
+    if (co1 != (CallOut1 *) NULL) {
+	FREE(co1);
+    }
+}
+
+/*
+ * restore callout table
+ */
+void CallOut::restore(int fd, Uint t, bool conv16, bool conv19)
+{
+    CallOutHeader dh;
+    CallOut2 *co2;
+    cindex n, i;
+
+    if (conv19) {
+	restore1(fd, t, conv16);
+	return;
+    }
+
+    /* read and check header */
+    Config::dread(fd, (char *) &dh, dh_layout, (Uint) 1);
+    timestamp = dh.timestamp;
+    timediff = t - timestamp;
+    wtime = dh.wtime;
+
+    n = dh.nrunning + dh.nimmediate + dh.nwheel;
+    if (n > cotabsz) {
+	EC->error("Restored too many callouts");
+    }
+
+    /* read callouts and put them in place */
+    if (n != 0) {
+	co2 = ALLOC(CallOut2, n);
+	Config::dread(fd, (char *) co2, CO2_LAYOUT, (Uint) n);
+	for (i = 0; i < n; i++) {
+	    insert(co2[i].oindex, co2[i].handle, co2[i].time,
+		   (i < dh.nrunning) ? &running :
+		    (i < dh.nrunning + dh.nimmediate) ?
+		     &immediate : (cindex *) NULL);
+	}
+	FREE(co2);
     }
 }
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -25,8 +25,7 @@ public:
     static void create(unsigned int oindex, unsigned int handle, Uint t,
 		       unsigned int m, cindex *q);
     static LPCint remaining(Uint t, unsigned short *m);
-    static void del(unsigned int oindex, unsigned int handle, Uint t,
-		    unsigned int m);
+    static void del(unsigned int oindex, unsigned int handle);
     static void list(Array *a);
     static void call(Frame *f);
     static void info(cindex *n1, cindex *n2);
@@ -36,27 +35,27 @@ public:
     static long swaprate1();
     static long swaprate5();
     static bool save(int fd);
-    static void restore(int fd, Uint t, bool conv16);
+    static void restore(int fd, Uint t, bool conv16, bool conv19);
 
 private:
-    static CallOut *enqueue(Uint t, unsigned short m);
+    static void link(cindex *list, cindex i);
+    static void unlink(cindex *list, cindex i);
+    static int level(Time t);
+    static void enqueue(cindex i);
     static void dequeue(cindex i);
-    static CallOut *newcallout(cindex *list, Uint t);
-    static void freecallout(cindex *cyc, cindex j, cindex i, Uint t);
-    static bool rmshort(cindex *cyc, uindex i, uindex handle, Uint t);
+    static Time nextslot(int *lp, unsigned int *sp);
+    static cindex newcallout(unsigned int oindex, unsigned int handle);
+    static void freecallout(cindex i);
+    static void insert(unsigned int oindex, unsigned int handle, Time time,
+		       cindex *list);
     static void expire();
+    static void prefetch(cindex list);
+    static void restore1(int fd, Uint t, bool conv16);
 
-    union {
-	Time time;	/* when to call */
-	struct {
-	    cindex count;	/* # in list */
-	    cindex prev;	/* previous in list */
-	    cindex next;	/* next in list */
-	} r;
-    };
+    Time time;		/* when to call, in milliseconds */
+    cindex prev;	/* previous in list */
+    cindex next;	/* next in list */
+    cindex hnext;	/* next in hash chain */
     uindex handle;	/* callout handle */
     uindex oindex;	/* index in object table */
 };
-
-# define CO1_LAYOUT	"[l|fff]uu"
-# define CO2_LAYOUT	"[fff|l]uu"
@@ -100,6 +100,10 @@ static User *flush;		/* flush list */
 static Uint nusers;		/* # of users */
 static int odone;		/* # of users with output done */
 static uindex this_user;	/* current user */
+static size_t nmessages;	/* # messages and datagrams sent */
+static size_t nsyscalls;	/* # system calls used to send them */
+static String *sendstr;		/* last string sent to a telnet user */
+static String *sendtel;		/* telnet encoding of that string */
 
 /*
  * accept a new connection
@@ -313,11 +317,12 @@ void User::uflush(Object *obj, Dataspace *data, Array *arr)
 
     if (v[1].type == T_STRING) {
 	if (conn->wrdone()) {
+	    nsyscalls++;
 	    n = conn->write(v[1].string->text + osdone,
 			    v[1].string->len - osdone);
 	    if (n >= 0) {
 		n += osdone;
-		if (n == v[1].string->len) {
+		if (n == (int) v[1].string->len) {
 		    /* buffer fully drained */
 		    n = 0;
 		    flags &= ~CF_OUTPUT;
@@ -338,7 +343,9 @@ void User::uflush(Object *obj, Dataspace *data, Array *arr)
 
     if (v[2].type == T_STRING) {
 	if (flags & CF_UDPDATA) {
-	    conn->writeUdp(v[2].string->text, v[2].string->len);
+	    if (conn->writeUdp(v[2].string->text, v[2].string->len) < 0) {
+		--nmessages;	/* not sent after all */
+	    }
 	} else if (conn->udp(v[2].string->text, v[2].string->len)) {
 	    flags |= CF_UDP;
 	}
@@ -386,6 +393,8 @@ bool Comm::init(int n, int p, char **thosts, char **bhosts, char **dhosts,
     ::flush = outbound = (User *) NULL;
     nusers = odone = newlines = 0;
     this_user = OBJ_NONE;
+    nmessages = nsyscalls = 0;
+    sendstr = sendtel = (String *) NULL;
 
     snprintf(ayt, sizeof(ayt), "\15\12[%s]\15\12", VERSION);
 
@@ -551,6 +560,58 @@ void Comm::challenge(Object *obj, String *str)
     data->assignElt(arr, v, &val);
 }
 
+/*
+ * return the telnet encoding of a string, which can be shared by all users
+ * that the string is sent to
+ */
+static String *encode(String *str)
+{
+    char *p, *q;
+    ssizet len;
+    long size;
+    String *tel;
+
+    if (str != sendstr) {
+	if (sendstr != (String *) NULL) {
+	    sendstr->del();
+	    sendtel->del();
+	    sendstr = sendtel = (String *) NULL;
+	}
+
+	for (p = str->text, len = str->len, size = len; len != 0; p++, --len) {
+	    if (*p == LF || UCHAR(*p) == IAC) {
+		size++;
+	    }
+	}
+	if (size > MAX_STRLEN) {
+	    return (String *) NULL;
+	}
+
+	if (size == str->len) {
+	    tel = str;	/* nothing to escape */
+	} else {
+	    tel = String::create((char *) NULL, size);
+	    for (p = str->text, q = tel->text, len = str->len; len != 0; --len)
+	    {
+		if (UCHAR(*p) == IAC) {
+		    /* double the telnet IAC character */
+		    *q++ = (char) IAC;
+		} else if (*p == LF) {
+		    /* insert CR before LF */
+		    *q++ = CR;
+		}
+		*q++ = *p++;
+	    }
+	}
+	sendstr = str;
+	sendstr->ref();
+	sendtel = tel;
+	sendtel->ref();
+    }
+
+    return sendtel;
+}
+
 /*
  * send a message to a user
  */
@@ -564,14 +625,23 @@ int Comm::send(Object *obj, String *str)
 	EC->error("Output channel closed");
     }
     usr = &users[EINDEX(obj->etabi)];
+    nmessages++;
     if (usr->flags & CF_TELNET) {
 	char outbuf[OUTBUF_SIZE];
 	char *p, *q;
 	unsigned int len, size, n;
+	String *tel;
 
 	/*
 	 * telnet connection
 	 */
+	if (v[1].type != T_STRING &&
+	    (tel=encode(str)) != (String *) NULL) {
+	    /* no pending output: share the encoded string */
+	    usr->write(obj, tel, tel->text, tel->len);
+	    return str->len;
+	}
+
 	p = str->text;
 	len = str->len;
 	q = outbuf;
@@ -663,6 +733,7 @@ int Comm::udpsend(Object *obj, String *str)
     usr->flags |= CF_OUTPUT;
     PUT_STRVAL_NOREF(&val, str);
     data->assignElt(arr, v, &val);
+    nmessages++;
 
     return str->len;
 }
@@ -761,6 +832,7 @@ void Comm::flush()
     Object *obj;
     Array *arr;
     Value *v;
+    int failed;
 
     while (outbound != (User *) NULL) {
 	usr = outbound;
@@ -902,6 +974,16 @@ void Comm::flush()
 	arr->del();
 	usr->flags &= ~CF_FLUSH;
     }
+
+    /* send queued datagrams */
+    nsyscalls += Connection::flushUdp(&failed);
+    nmessages -= failed;
+
+    if (sendstr != (String *) NULL) {
+	sendstr->del();
+	sendtel->del();
+	sendstr = sendtel = (String *) NULL;
+    }
 }
 
 /*
@@ -1105,6 +1187,17 @@ void Comm::receive(Frame *f, Uint timeout, unsigned int mtime)
 	    } while (n != nextdport);
 	}
 
+	/* users with input waiting will need their objects soon */
+	usr = lastuser;
+	for (i = nusers; usr != (User *) NULL && i > 0; --i) {
+	    if (usr->newlines != 0 ||
+		(!(usr->flags & (CF_BLOCKED | CF_OPENDING)) &&
+		 usr->conn != (Connection *) NULL && usr->conn->readable())) {
+		OBJ(usr->oindex)->prefetch();
+	    }
+	    usr = usr->next;
+	}
+
 	for (i = nusers; lastuser != (User *) NULL && i > 0; --i) {
 	    usr = lastuser;
 	    lastuser = usr->next;
@@ -1524,6 +1617,15 @@ eindex Comm::numUsers()
     return nusers;
 }
 
+/*
+ * return output statistics
+ */
+void Comm::info(size_t *messages, size_t *syscalls)
+{
+    *messages = nmessages;
+    *syscalls = nsyscalls;
+}
+
 /*
  * return an array with all user objects
  */
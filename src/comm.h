@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -30,6 +30,7 @@ public:
     virtual void stop() = 0;
     virtual bool udpCheck() = 0;
     virtual int read(char *buf, unsigned int len) = 0;
+    virtual bool readable() = 0;
     virtual int readUdp(char *buf, unsigned int len) = 0;
     virtual int write(char *buf, unsigned int len) = 0;
     virtual int writeUdp(char *buf, unsigned int len) = 0;
@@ -48,6 +49,7 @@ public:
     static void finish();
     static void listen();
     static int select(Uint t, unsigned int mtime);
+    static int flushUdp(int *failed);
     static void *host(char *addr, unsigned short port, int *len);
     static int fdcount();
     static void fdlist(int *list);
@@ -91,6 +93,7 @@ public:
     static void connectDgram(Frame *f, Object *obj, int uport, char *addr,
 			     unsigned short port);
     static eindex numUsers();
+    static void info(size_t *messages, size_t *syscalls);
     static Array *listUsers(Dataspace*);
     static bool isConnection(Object*);
     static bool save(int);
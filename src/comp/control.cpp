@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -1751,11 +1751,12 @@ bool Control::checkFuncs()
 
     if (nfclash != 0 || privinherit) {
 	Hash::Entry **t;
-	unsigned short sz;
+	Uint sz;
 	VFH **f, **n;
 	bool clash;
 
 	clash = FALSE;
+	ftab->settle();
 	for (t = ftab->table, sz = ftab->size; sz > 0; t++, --sz) {
 	    for (f = (VFH **) t; *f != (VFH *) NULL; ) {
 		if ((*f)->ohash == (ObjHash *) NULL) {
@@ -2422,6 +2423,7 @@ struct StrConst0 {
 
 static bool conv_14;			/* convert arrays & strings? */
 static bool conv_15, conv_16;		/* convert control blocks? */
+static bool conv_20;			/* predictor compression only? */
 static bool convDone;			/* conversion complete? */
 
 /*
@@ -2541,7 +2543,14 @@ Control *Control::load(Object *obj, Uint instance,
  */
 Control *Control::load(Object *obj, Uint instance)
 {
-    return load(obj, instance, Swap::readv);
+    Control *ctrl;
+
+    ctrl = load(obj, instance, Swap::readv);
+    if (ctrl->nsectors > 1) {
+	/* program and strings will be loaded on demand */
+	Swap::prefetch(ctrl->sectors + 1, ctrl->nsectors - 1);
+    }
+    return ctrl;
 }
 
 /*
@@ -2664,9 +2673,13 @@ Control *Control::conv(Object *obj, Uint instance,
 	if (header.progsize != 0) {
 	    /* program */
 	    if (header.flags & CMP_TYPE) {
+		if (conv_20 && (header.flags & CMP_TYPE) != CMP_PRED) {
+		    EC->fatal("bad compression in old snapshot");
+		}
 		ctrl->prog = Swap::decompress(ctrl->sectors, readv,
 					      header.progsize, size,
-					      &ctrl->progsize);
+					      &ctrl->progsize,
+					      header.flags & CMP_TYPE);
 	    } else {
 		ctrl->prog = ALLOC(char, header.progsize);
 		(*readv)(ctrl->prog, ctrl->sectors, header.progsize, size);
@@ -2695,9 +2708,15 @@ Control *Control::conv(Object *obj, Uint instance,
 	    }
 	    if (header.strsize != 0) {
 		if (header.flags & (CMP_TYPE << 2)) {
+		    if (conv_20 &&
+			((header.flags >> 2) & CMP_TYPE) != CMP_PRED) {
+			EC->fatal("bad compression in old snapshot");
+		    }
 		    ctrl->stext = Swap::decompress(ctrl->sectors, readv,
 						   header.strsize, size,
-						   &ctrl->strsize);
+						   &ctrl->strsize,
+						   (header.flags >> 2) &
+								    CMP_TYPE);
 		} else {
 		    ctrl->stext = ALLOC(char, header.strsize);
 		    (*readv)(ctrl->stext, ctrl->sectors, header.strsize, size);
@@ -2764,7 +2783,7 @@ void Control::loadProgram(void (*readv) (char*, Sector*, Uint, Uint))
     if (progsize != 0) {
 	if (flags & CTRL_PROGCMP) {
 	    prog = Swap::decompress(sectors, readv, progsize, progoffset,
-				    &progsize);
+				    &progsize, flags & CTRL_PROGCMP);
 	} else {
 	    prog = ALLOC(char, progsize);
 	    (*readv)(prog, sectors, progsize, progoffset);
@@ -2792,7 +2811,7 @@ void Control::loadStext(void (*readv) (char*, Sector*, Uint, Uint))
     if (flags & CTRL_STRCMP) {
 	stext = Swap::decompress(sectors, readv, strsize,
 				 stroffset + nstrings * sizeof(ssizet),
-				 &strsize);
+				 &strsize, (flags & CTRL_STRCMP) >> 2);
     } else {
 	stext = ALLOC(char, strsize);
 	(*readv)(stext, sectors, strsize,
@@ -3064,9 +3083,10 @@ void Control::save()
 	prog = this->prog;
 	if (header.progsize >= CMPLIMIT) {
 	    prog = ALLOC(char, header.progsize);
-	    size = Swap::compress(prog, this->prog, header.progsize);
+	    size = Swap::compress(prog, this->prog, header.progsize,
+				  CMP_DEFAULT);
 	    if (size != 0) {
-		header.flags |= CMP_PRED;
+		header.flags |= CMP_DEFAULT;
 		header.progsize = size;
 	    } else {
 		FREE(prog);
@@ -3099,9 +3119,9 @@ void Control::save()
 	text = stext;
 	if (header.strsize >= CMPLIMIT) {
 	    text = ALLOC(char, header.strsize);
-	    size = Swap::compress(text, stext, header.strsize);
+	    size = Swap::compress(text, stext, header.strsize, CMP_DEFAULT);
 	    if (size != 0) {
-		header.flags |= CMP_PRED << 2;
+		header.flags |= CMP_DEFAULT << 2;
 		header.strsize = size;
 	    } else {
 		FREE(text);
@@ -3399,18 +3419,19 @@ void Control::init()
 {
     chead = ctail = (Control *) NULL;
     nctrl = 0;
-    conv_14 = conv_15 = conv_16 = FALSE;
+    conv_14 = conv_15 = conv_16 = conv_20 = FALSE;
     convDone = FALSE;
 }
 
 /*
  * prepare for conversions
  */
-void Control::initConv(bool c14, bool c15, bool c16)
+void Control::initConv(bool c14, bool c15, bool c16, bool c20)
 {
     conv_14 = c14;
     conv_15 = c15;
     conv_16 = c16;
+    conv_20 = c20;
 }
 
 /*
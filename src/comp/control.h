@@ -94,7 +94,7 @@ public:
     static Control *restore(Object *obj, Uint instance,
 			    void(*)(char*, Sector*, Uint, Uint));
     static void init();
-    static void initConv(bool c14, bool c15, bool c16);
+    static void initConv(bool c14, bool c15, bool c16, bool c20);
     static void converted();
     static void swapout(unsigned int frag);
 
@@ -206,11 +206,6 @@ private:
 # define CTRL_PUREFLOAT		0x020	/* has unconstrained floats */
 # define CTRL_VARMAP		0x040	/* varmap updated */
 
-/* data compression */
-# define CMP_TYPE		0x03
-# define CMP_NONE		0x00	/* no compression */
-# define CMP_PRED		0x01	/* predictor compression */
-
 # define PROTO_CLASS(prot)	((prot)[0])
 # define PROTO_NARGS(prot)	((prot)[1])
 # define PROTO_VARGS(prot)	((prot)[2])
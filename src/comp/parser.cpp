@@ -0,0 +1,4628 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 26 "parser.y"
+
+
+# define INCLUDE_CTYPE
+# include "comp.h"
+# include "str.h"
+# include "array.h"
+# include "object.h"
+# include "xfloat.h"
+# include "control.h"
+# include "data.h"
+# include "interpret.h"
+# include "ppcontrol.h"
+# include "table.h"
+# include "node.h"
+# include "compile.h"
+
+# define yylex		PP->gettok
+# define yyerror	Compile::error
+# define register	/* nothing */
+
+int nerrors;			/* number of errors encountered so far */
+static int ndeclarations;	/* number of declarations */
+static int nstatements;		/* number of statements in current function */
+static bool typechecking;	/* does the current function have it? */
+
+class YYParser {
+public:
+    static void _void(Node *n);
+    static Node *prefix(int op, Node *n, const char *name);
+    static Node *postfix(int op, Node *n, const char *name);
+    static Node *cast(Node *n, Node *type);
+    static Node *idx(Node *n1, Node *n2);
+    static Node *range(Node *n1, Node *n2, Node *n3);
+    static Node *bini(int op, Node *n1, Node *n2, const char *name);
+    static Node *bina(int op, Node *n1, Node *n2, const char *name);
+    static Node *mult(int op, Node *n1, Node *n2, const char *name);
+    static Node *mdiv(int op, Node *n1, Node *n2, const char *name);
+    static Node *mod(int op, Node *n1, Node *n2, const char *name);
+    static Node *add(int op, Node *n1, Node *n2, const char *name);
+    static Node *sub(int op, Node *n1, Node *n2, const char *name);
+    static Node *umin(Node *n);
+    static Node *lshift(int op, Node *n1, Node *n2, const char *name);
+    static Node *rshift(int op, Node *n1, Node *n2, const char *name);
+    static Node *rel(int op, Node *n1, Node *n2, const char *name);
+    static Node *eq(Node *n1, Node *n2);
+    static Node *_and(int op, Node *n1, Node *n2, const char *name);
+    static Node *_xor(int op, Node *n1, Node *n2, const char *name);
+    static Node *_or(int op, Node *n1, Node *n2, const char *name);
+    static Node *land(Node *n1, Node *n2);
+    static Node *lor(Node *n1, Node *n2);
+    static Node *quest(Node *n1, Node *n2, Node *n3);
+    static Node *assign(Node *n1, Node *n2);
+    static Node *comma(Node *n1, Node *n2);
+
+private:
+    static bool unary(Node *n, const char *name);
+};
+
+
+#line 131 "y.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    NOMASK = 258,                  /* NOMASK  */
+    BREAK = 259,                   /* BREAK  */
+    DO = 260,                      /* DO  */
+    MAPPING = 261,                 /* MAPPING  */
+    ELSE = 262,                    /* ELSE  */
+    CASE = 263,                    /* CASE  */
+    OBJECT = 264,                  /* OBJECT  */
+    DEFAULT = 265,                 /* DEFAULT  */
+    FLOAT = 266,                   /* FLOAT  */
+    CONTINUE = 267,                /* CONTINUE  */
+    STATIC = 268,                  /* STATIC  */
+    INT = 269,                     /* INT  */
+    FOR = 270,                     /* FOR  */
+    IF = 271,                      /* IF  */
+    OPERATOR = 272,                /* OPERATOR  */
+    INHERIT = 273,                 /* INHERIT  */
+    RLIMITS = 274,                 /* RLIMITS  */
+    GOTO = 275,                    /* GOTO  */
+    FUNCTION = 276,                /* FUNCTION  */
+    RETURN = 277,                  /* RETURN  */
+    MIXED = 278,                   /* MIXED  */
+    WHILE = 279,                   /* WHILE  */
+    STRING = 280,                  /* STRING  */
+    TRY = 281,                     /* TRY  */
+    PRIVATE = 282,                 /* PRIVATE  */
+    VOID = 283,                    /* VOID  */
+    NEW = 284,                     /* NEW  */
+    CATCH = 285,                   /* CATCH  */
+    ATOMIC = 286,                  /* ATOMIC  */
+    NIL = 287,                     /* NIL  */
+    SWITCH = 288,                  /* SWITCH  */
+    VARARGS = 289,                 /* VARARGS  */
+    LARROW = 290,                  /* LARROW  */
+    RARROW = 291,                  /* RARROW  */
+    PLUS_PLUS = 292,               /* PLUS_PLUS  */
+    MIN_MIN = 293,                 /* MIN_MIN  */
+    LSHIFT = 294,                  /* LSHIFT  */
+    RSHIFT = 295,                  /* RSHIFT  */
+    LE = 296,                      /* LE  */
+    GE = 297,                      /* GE  */
+    EQ = 298,                      /* EQ  */
+    NE = 299,                      /* NE  */
+    LAND = 300,                    /* LAND  */
+    LOR = 301,                     /* LOR  */
+    PLUS_EQ = 302,                 /* PLUS_EQ  */
+    MIN_EQ = 303,                  /* MIN_EQ  */
+    MULT_EQ = 304,                 /* MULT_EQ  */
+    DIV_EQ = 305,                  /* DIV_EQ  */
+    MOD_EQ = 306,                  /* MOD_EQ  */
+    LSHIFT_EQ = 307,               /* LSHIFT_EQ  */
+    RSHIFT_EQ = 308,               /* RSHIFT_EQ  */
+    AND_EQ = 309,                  /* AND_EQ  */
+    XOR_EQ = 310,                  /* XOR_EQ  */
+    OR_EQ = 311,                   /* OR_EQ  */
+    COLON_COLON = 312,             /* COLON_COLON  */
+    DOT_DOT = 313,                 /* DOT_DOT  */
+    ELLIPSIS = 314,                /* ELLIPSIS  */
+    STRING_CONST = 315,            /* STRING_CONST  */
+    IDENTIFIER = 316,              /* IDENTIFIER  */
+    INT_CONST = 317,               /* INT_CONST  */
+    FLOAT_CONST = 318,             /* FLOAT_CONST  */
+    MARK = 319,                    /* MARK  */
+    HASH = 320,                    /* HASH  */
+    HASH_HASH = 321,               /* HASH_HASH  */
+    INCL_CONST = 322,              /* INCL_CONST  */
+    NR_TOKENS = 323                /* NR_TOKENS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define NOMASK 258
+#define BREAK 259
+#define DO 260
+#define MAPPING 261
+#define ELSE 262
+#define CASE 263
+#define OBJECT 264
+#define DEFAULT 265
+#define FLOAT 266
+#define CONTINUE 267
+#define STATIC 268
+#define INT 269
+#define FOR 270
+#define IF 271
+#define OPERATOR 272
+#define INHERIT 273
+#define RLIMITS 274
+#define GOTO 275
+#define FUNCTION 276
+#define RETURN 277
+#define MIXED 278
+#define WHILE 279
+#define STRING 280
+#define TRY 281
+#define PRIVATE 282
+#define VOID 283
+#define NEW 284
+#define CATCH 285
+#define ATOMIC 286
+#define NIL 287
+#define SWITCH 288
+#define VARARGS 289
+#define LARROW 290
+#define RARROW 291
+#define PLUS_PLUS 292
+#define MIN_MIN 293
+#define LSHIFT 294
+#define RSHIFT 295
+#define LE 296
+#define GE 297
+#define EQ 298
+#define NE 299
+#define LAND 300
+#define LOR 301
+#define PLUS_EQ 302
+#define MIN_EQ 303
+#define MULT_EQ 304
+#define DIV_EQ 305
+#define MOD_EQ 306
+#define LSHIFT_EQ 307
+#define RSHIFT_EQ 308
+#define AND_EQ 309
+#define XOR_EQ 310
+#define OR_EQ 311
+#define COLON_COLON 312
+#define DOT_DOT 313
+#define ELLIPSIS 314
+#define STRING_CONST 315
+#define IDENTIFIER 316
+#define INT_CONST 317
+#define FLOAT_CONST 318
+#define MARK 319
+#define HASH 320
+#define HASH_HASH 321
+#define INCL_CONST 322
+#define NR_TOKENS 323
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 101 "parser.y"
+
+    LPCint number;		/* lex input */
+    Float real;			/* lex input */
+    unsigned short type;	/* internal */
+    class Node *node;		/* internal */
+
+#line 327 "y.tab.c"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_NOMASK = 3,                     /* NOMASK  */
+  YYSYMBOL_BREAK = 4,                      /* BREAK  */
+  YYSYMBOL_DO = 5,                         /* DO  */
+  YYSYMBOL_MAPPING = 6,                    /* MAPPING  */
+  YYSYMBOL_ELSE = 7,                       /* ELSE  */
+  YYSYMBOL_CASE = 8,                       /* CASE  */
+  YYSYMBOL_OBJECT = 9,                     /* OBJECT  */
+  YYSYMBOL_DEFAULT = 10,                   /* DEFAULT  */
+  YYSYMBOL_FLOAT = 11,                     /* FLOAT  */
+  YYSYMBOL_CONTINUE = 12,                  /* CONTINUE  */
+  YYSYMBOL_STATIC = 13,                    /* STATIC  */
+  YYSYMBOL_INT = 14,                       /* INT  */
+  YYSYMBOL_FOR = 15,                       /* FOR  */
+  YYSYMBOL_IF = 16,                        /* IF  */
+  YYSYMBOL_OPERATOR = 17,                  /* OPERATOR  */
+  YYSYMBOL_INHERIT = 18,                   /* INHERIT  */
+  YYSYMBOL_RLIMITS = 19,                   /* RLIMITS  */
+  YYSYMBOL_GOTO = 20,                      /* GOTO  */
+  YYSYMBOL_FUNCTION = 21,                  /* FUNCTION  */
+  YYSYMBOL_RETURN = 22,                    /* RETURN  */
+  YYSYMBOL_MIXED = 23,                     /* MIXED  */
+  YYSYMBOL_WHILE = 24,                     /* WHILE  */
+  YYSYMBOL_STRING = 25,                    /* STRING  */
+  YYSYMBOL_TRY = 26,                       /* TRY  */
+  YYSYMBOL_PRIVATE = 27,                   /* PRIVATE  */
+  YYSYMBOL_VOID = 28,                      /* VOID  */
+  YYSYMBOL_NEW = 29,                       /* NEW  */
+  YYSYMBOL_CATCH = 30,                     /* CATCH  */
+  YYSYMBOL_ATOMIC = 31,                    /* ATOMIC  */
+  YYSYMBOL_NIL = 32,                       /* NIL  */
+  YYSYMBOL_SWITCH = 33,                    /* SWITCH  */
+  YYSYMBOL_VARARGS = 34,                   /* VARARGS  */
+  YYSYMBOL_LARROW = 35,                    /* LARROW  */
+  YYSYMBOL_RARROW = 36,                    /* RARROW  */
+  YYSYMBOL_PLUS_PLUS = 37,                 /* PLUS_PLUS  */
+  YYSYMBOL_MIN_MIN = 38,                   /* MIN_MIN  */
+  YYSYMBOL_LSHIFT = 39,                    /* LSHIFT  */
+  YYSYMBOL_RSHIFT = 40,                    /* RSHIFT  */
+  YYSYMBOL_LE = 41,                        /* LE  */
+  YYSYMBOL_GE = 42,                        /* GE  */
+  YYSYMBOL_EQ = 43,                        /* EQ  */
+  YYSYMBOL_NE = 44,                        /* NE  */
+  YYSYMBOL_LAND = 45,                      /* LAND  */
+  YYSYMBOL_LOR = 46,                       /* LOR  */
+  YYSYMBOL_PLUS_EQ = 47,                   /* PLUS_EQ  */
+  YYSYMBOL_MIN_EQ = 48,                    /* MIN_EQ  */
+  YYSYMBOL_MULT_EQ = 49,                   /* MULT_EQ  */
+  YYSYMBOL_DIV_EQ = 50,                    /* DIV_EQ  */
+  YYSYMBOL_MOD_EQ = 51,                    /* MOD_EQ  */
+  YYSYMBOL_LSHIFT_EQ = 52,                 /* LSHIFT_EQ  */
+  YYSYMBOL_RSHIFT_EQ = 53,                 /* RSHIFT_EQ  */
+  YYSYMBOL_AND_EQ = 54,                    /* AND_EQ  */
+  YYSYMBOL_XOR_EQ = 55,                    /* XOR_EQ  */
+  YYSYMBOL_OR_EQ = 56,                     /* OR_EQ  */
+  YYSYMBOL_COLON_COLON = 57,               /* COLON_COLON  */
+  YYSYMBOL_DOT_DOT = 58,                   /* DOT_DOT  */
+  YYSYMBOL_ELLIPSIS = 59,                  /* ELLIPSIS  */
+  YYSYMBOL_STRING_CONST = 60,              /* STRING_CONST  */
+  YYSYMBOL_IDENTIFIER = 61,                /* IDENTIFIER  */
+  YYSYMBOL_INT_CONST = 62,                 /* INT_CONST  */
+  YYSYMBOL_FLOAT_CONST = 63,               /* FLOAT_CONST  */
+  YYSYMBOL_MARK = 64,                      /* MARK  */
+  YYSYMBOL_HASH = 65,                      /* HASH  */
+  YYSYMBOL_HASH_HASH = 66,                 /* HASH_HASH  */
+  YYSYMBOL_INCL_CONST = 67,                /* INCL_CONST  */
+  YYSYMBOL_NR_TOKENS = 68,                 /* NR_TOKENS  */
+  YYSYMBOL_69_ = 69,                       /* ';'  */
+  YYSYMBOL_70_ = 70,                       /* '+'  */
+  YYSYMBOL_71_ = 71,                       /* '('  */
+  YYSYMBOL_72_ = 72,                       /* ')'  */
+  YYSYMBOL_73_ = 73,                       /* ','  */
+  YYSYMBOL_74_ = 74,                       /* '*'  */
+  YYSYMBOL_75_ = 75,                       /* '-'  */
+  YYSYMBOL_76_ = 76,                       /* '/'  */
+  YYSYMBOL_77_ = 77,                       /* '%'  */
+  YYSYMBOL_78_ = 78,                       /* '&'  */
+  YYSYMBOL_79_ = 79,                       /* '^'  */
+  YYSYMBOL_80_ = 80,                       /* '|'  */
+  YYSYMBOL_81_ = 81,                       /* '<'  */
+  YYSYMBOL_82_ = 82,                       /* '>'  */
+  YYSYMBOL_83_ = 83,                       /* '~'  */
+  YYSYMBOL_84_ = 84,                       /* '['  */
+  YYSYMBOL_85_ = 85,                       /* ']'  */
+  YYSYMBOL_86_ = 86,                       /* '='  */
+  YYSYMBOL_87_ = 87,                       /* '{'  */
+  YYSYMBOL_88_ = 88,                       /* '}'  */
+  YYSYMBOL_89_ = 89,                       /* ':'  */
+  YYSYMBOL_90_ = 90,                       /* '!'  */
+  YYSYMBOL_91_ = 91,                       /* '?'  */
+  YYSYMBOL_YYACCEPT = 92,                  /* $accept  */
+  YYSYMBOL_program = 93,                   /* program  */
+  YYSYMBOL_94_1 = 94,                      /* $@1  */
+  YYSYMBOL_top_level_declarations = 95,    /* top_level_declarations  */
+  YYSYMBOL_top_level_declaration = 96,     /* top_level_declaration  */
+  YYSYMBOL_opt_inherit_label = 97,         /* opt_inherit_label  */
+  YYSYMBOL_ident = 98,                     /* ident  */
+  YYSYMBOL_exception = 99,                 /* exception  */
+  YYSYMBOL_composite_string = 100,         /* composite_string  */
+  YYSYMBOL_string_exp = 101,               /* string_exp  */
+  YYSYMBOL_string = 102,                   /* string  */
+  YYSYMBOL_data_declaration = 103,         /* data_declaration  */
+  YYSYMBOL_function_declaration = 104,     /* function_declaration  */
+  YYSYMBOL_105_2 = 105,                    /* $@2  */
+  YYSYMBOL_106_3 = 106,                    /* $@3  */
+  YYSYMBOL_local_data_declaration = 107,   /* local_data_declaration  */
+  YYSYMBOL_formals_declaration = 108,      /* formals_declaration  */
+  YYSYMBOL_formal_declaration_list = 109,  /* formal_declaration_list  */
+  YYSYMBOL_varargs_formal_declaration = 110, /* varargs_formal_declaration  */
+  YYSYMBOL_formal_declaration = 111,       /* formal_declaration  */
+  YYSYMBOL_class_specifier_list = 112,     /* class_specifier_list  */
+  YYSYMBOL_class_specifier_list2 = 113,    /* class_specifier_list2  */
+  YYSYMBOL_class_specifier = 114,          /* class_specifier  */
+  YYSYMBOL_opt_private = 115,              /* opt_private  */
+  YYSYMBOL_non_private = 116,              /* non_private  */
+  YYSYMBOL_type_specifier = 117,           /* type_specifier  */
+  YYSYMBOL_opt_object = 118,               /* opt_object  */
+  YYSYMBOL_star_list = 119,                /* star_list  */
+  YYSYMBOL_data_dcltr = 120,               /* data_dcltr  */
+  YYSYMBOL_operator = 121,                 /* operator  */
+  YYSYMBOL_function_name = 122,            /* function_name  */
+  YYSYMBOL_function_dcltr = 123,           /* function_dcltr  */
+  YYSYMBOL_dcltr = 124,                    /* dcltr  */
+  YYSYMBOL_list_dcltr = 125,               /* list_dcltr  */
+  YYSYMBOL_dcltr_or_stmt_list = 126,       /* dcltr_or_stmt_list  */
+  YYSYMBOL_dcltr_or_stmt = 127,            /* dcltr_or_stmt  */
+  YYSYMBOL_if_stmt = 128,                  /* if_stmt  */
+  YYSYMBOL_129_4 = 129,                    /* $@4  */
+  YYSYMBOL_stmt = 130,                     /* stmt  */
+  YYSYMBOL_nocase_stmt = 131,              /* nocase_stmt  */
+  YYSYMBOL_132_5 = 132,                    /* $@5  */
+  YYSYMBOL_133_6 = 133,                    /* $@6  */
+  YYSYMBOL_134_7 = 134,                    /* $@7  */
+  YYSYMBOL_135_8 = 135,                    /* $@8  */
+  YYSYMBOL_136_9 = 136,                    /* $@9  */
+  YYSYMBOL_137_10 = 137,                   /* $@10  */
+  YYSYMBOL_138_11 = 138,                   /* $@11  */
+  YYSYMBOL_139_12 = 139,                   /* $@12  */
+  YYSYMBOL_140_13 = 140,                   /* $@13  */
+  YYSYMBOL_141_14 = 141,                   /* $@14  */
+  YYSYMBOL_142_15 = 142,                   /* $@15  */
+  YYSYMBOL_143_16 = 143,                   /* $@16  */
+  YYSYMBOL_144_17 = 144,                   /* $@17  */
+  YYSYMBOL_145_18 = 145,                   /* $@18  */
+  YYSYMBOL_compound_stmt = 146,            /* compound_stmt  */
+  YYSYMBOL_147_19 = 147,                   /* $@19  */
+  YYSYMBOL_opt_caught_stmt = 148,          /* opt_caught_stmt  */
+  YYSYMBOL_case_list = 149,                /* case_list  */
+  YYSYMBOL_case = 150,                     /* case  */
+  YYSYMBOL_function_call = 151,            /* function_call  */
+  YYSYMBOL_primary_p1_exp = 152,           /* primary_p1_exp  */
+  YYSYMBOL_153_20 = 153,                   /* $@20  */
+  YYSYMBOL_primary_p2_exp = 154,           /* primary_p2_exp  */
+  YYSYMBOL_postfix_exp = 155,              /* postfix_exp  */
+  YYSYMBOL_prefix_exp = 156,               /* prefix_exp  */
+  YYSYMBOL_cast_exp = 157,                 /* cast_exp  */
+  YYSYMBOL_mult_oper_exp = 158,            /* mult_oper_exp  */
+  YYSYMBOL_add_oper_exp = 159,             /* add_oper_exp  */
+  YYSYMBOL_shift_oper_exp = 160,           /* shift_oper_exp  */
+  YYSYMBOL_rel_oper_exp = 161,             /* rel_oper_exp  */
+  YYSYMBOL_equ_oper_exp = 162,             /* equ_oper_exp  */
+  YYSYMBOL_bitand_oper_exp = 163,          /* bitand_oper_exp  */
+  YYSYMBOL_bitxor_oper_exp = 164,          /* bitxor_oper_exp  */
+  YYSYMBOL_bitor_oper_exp = 165,           /* bitor_oper_exp  */
+  YYSYMBOL_and_oper_exp = 166,             /* and_oper_exp  */
+  YYSYMBOL_167_21 = 167,                   /* $@21  */
+  YYSYMBOL_or_oper_exp = 168,              /* or_oper_exp  */
+  YYSYMBOL_169_22 = 169,                   /* $@22  */
+  YYSYMBOL_cond_exp = 170,                 /* cond_exp  */
+  YYSYMBOL_171_23 = 171,                   /* $@23  */
+  YYSYMBOL_172_24 = 172,                   /* $@24  */
+  YYSYMBOL_exp = 173,                      /* exp  */
+  YYSYMBOL_list_exp = 174,                 /* list_exp  */
+  YYSYMBOL_opt_list_exp = 175,             /* opt_list_exp  */
+  YYSYMBOL_f_list_exp = 176,               /* f_list_exp  */
+  YYSYMBOL_f_opt_list_exp = 177,           /* f_opt_list_exp  */
+  YYSYMBOL_arg_list = 178,                 /* arg_list  */
+  YYSYMBOL_opt_arg_list = 179,             /* opt_arg_list  */
+  YYSYMBOL_opt_arg_list_comma = 180,       /* opt_arg_list_comma  */
+  YYSYMBOL_assoc_exp = 181,                /* assoc_exp  */
+  YYSYMBOL_assoc_arg_list = 182,           /* assoc_arg_list  */
+  YYSYMBOL_opt_assoc_arg_list_comma = 183  /* opt_assoc_arg_list_comma  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  3
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   660
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  92
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  92
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  240
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  417
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   323
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    90,     2,     2,     2,    77,    78,     2,
+      71,    72,    74,    70,    73,    75,     2,    76,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    89,    69,
+      81,    86,    82,    91,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    84,     2,    85,    79,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    87,    80,    88,    83,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   140,   140,   140,   153,   154,   163,   177,   179,   185,
+     186,   190,   195,   196,   201,   202,   207,   208,   213,   218,
+     224,   223,   235,   234,   251,   257,   258,   259,   260,   268,
+     269,   274,   279,   283,   292,   299,   300,   301,   306,   307,
+     312,   314,   319,   320,   325,   327,   329,   331,   336,   337,
+     338,   340,   342,   344,   346,   352,   353,   357,   358,   363,
+     364,   374,   382,   384,   386,   388,   390,   392,   394,   396,
+     398,   400,   402,   404,   406,   408,   410,   412,   414,   416,
+     418,   420,   425,   426,   430,   438,   439,   443,   444,   450,
+     451,   456,   463,   467,   478,   477,   483,   484,   496,   498,
+     499,   506,   505,   530,   535,   530,   545,   544,   554,   556,
+     553,   567,   566,   584,   589,   595,   584,   614,   619,   614,
+     630,   629,   634,   633,   636,   640,   644,   648,   650,   654,
+     654,   667,   668,   673,   679,   696,   698,   700,   705,   707,
+     709,   714,   716,   718,   719,   720,   722,   724,   747,   766,
+     768,   771,   773,   775,   778,   777,   784,   786,   788,   794,
+     799,   800,   802,   807,   808,   810,   815,   816,   818,   820,
+     822,   824,   829,   850,   851,   859,   860,   862,   864,   869,
+     870,   872,   877,   878,   880,   885,   886,   888,   890,   892,
+     897,   898,   900,   905,   906,   911,   912,   917,   918,   923,
+     925,   924,   934,   936,   935,   945,   947,   949,   946,   959,
+     960,   962,   967,   972,   977,   982,   987,   992,   997,  1002,
+    1007,  1015,  1016,  1022,  1023,  1027,  1032,  1037,  1038,  1047,
+    1048,  1049,  1062,  1063,  1064,  1069,  1078,  1079,  1085,  1086,
+    1087
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "NOMASK", "BREAK",
+  "DO", "MAPPING", "ELSE", "CASE", "OBJECT", "DEFAULT", "FLOAT",
+  "CONTINUE", "STATIC", "INT", "FOR", "IF", "OPERATOR", "INHERIT",
+  "RLIMITS", "GOTO", "FUNCTION", "RETURN", "MIXED", "WHILE", "STRING",
+  "TRY", "PRIVATE", "VOID", "NEW", "CATCH", "ATOMIC", "NIL", "SWITCH",
+  "VARARGS", "LARROW", "RARROW", "PLUS_PLUS", "MIN_MIN", "LSHIFT",
+  "RSHIFT", "LE", "GE", "EQ", "NE", "LAND", "LOR", "PLUS_EQ", "MIN_EQ",
+  "MULT_EQ", "DIV_EQ", "MOD_EQ", "LSHIFT_EQ", "RSHIFT_EQ", "AND_EQ",
+  "XOR_EQ", "OR_EQ", "COLON_COLON", "DOT_DOT", "ELLIPSIS", "STRING_CONST",
+  "IDENTIFIER", "INT_CONST", "FLOAT_CONST", "MARK", "HASH", "HASH_HASH",
+  "INCL_CONST", "NR_TOKENS", "';'", "'+'", "'('", "')'", "','", "'*'",
+  "'-'", "'/'", "'%'", "'&'", "'^'", "'|'", "'<'", "'>'", "'~'", "'['",
+  "']'", "'='", "'{'", "'}'", "':'", "'!'", "'?'", "$accept", "program",
+  "$@1", "top_level_declarations", "top_level_declaration",
+  "opt_inherit_label", "ident", "exception", "composite_string",
+  "string_exp", "string", "data_declaration", "function_declaration",
+  "$@2", "$@3", "local_data_declaration", "formals_declaration",
+  "formal_declaration_list", "varargs_formal_declaration",
+  "formal_declaration", "class_specifier_list", "class_specifier_list2",
+  "class_specifier", "opt_private", "non_private", "type_specifier",
+  "opt_object", "star_list", "data_dcltr", "operator", "function_name",
+  "function_dcltr", "dcltr", "list_dcltr", "dcltr_or_stmt_list",
+  "dcltr_or_stmt", "if_stmt", "$@4", "stmt", "nocase_stmt", "$@5", "$@6",
+  "$@7", "$@8", "$@9", "$@10", "$@11", "$@12", "$@13", "$@14", "$@15",
+  "$@16", "$@17", "$@18", "compound_stmt", "$@19", "opt_caught_stmt",
+  "case_list", "case", "function_call", "primary_p1_exp", "$@20",
+  "primary_p2_exp", "postfix_exp", "prefix_exp", "cast_exp",
+  "mult_oper_exp", "add_oper_exp", "shift_oper_exp", "rel_oper_exp",
+  "equ_oper_exp", "bitand_oper_exp", "bitxor_oper_exp", "bitor_oper_exp",
+  "and_oper_exp", "$@21", "or_oper_exp", "$@22", "cond_exp", "$@23",
+  "$@24", "exp", "list_exp", "opt_list_exp", "f_list_exp",
+  "f_opt_list_exp", "arg_list", "opt_arg_list", "opt_arg_list_comma",
+  "assoc_exp", "assoc_arg_list", "opt_assoc_arg_list_comma", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-267)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-226)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -267,    27,  -267,  -267,   162,  -267,  -267,    79,  -267,  -267,
+    -267,  -267,  -267,   149,   168,    16,   239,  -267,    88,  -267,
+    -267,   576,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,
+     -29,  -267,   168,  -267,  -267,    35,  -267,    88,     7,  -267,
+    -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,
+    -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,   -14,    -6,
+    -267,   -38,  -267,    81,    22,  -267,   159,  -267,     8,    88,
+      91,    87,  -267,   120,   123,   128,  -267,  -267,   145,   279,
+    -267,   148,    34,  -267,  -267,  -267,  -267,    88,  -267,  -267,
+    -267,  -267,    22,  -267,  -267,  -267,  -267,  -267,  -267,  -267,
+     506,    23,  -267,   115,   151,  -267,   128,  -267,  -267,  -267,
+    -267,   305,  -267,   157,   166,  -267,   184,   167,   180,   182,
+     187,   194,    35,   184,   197,  -267,   159,   200,  -267,   213,
+     184,   184,     9,  -267,  -267,  -267,   184,   549,   184,    96,
+     184,  -267,   184,    15,  -267,  -267,   574,  -267,   204,  -267,
+     230,  -267,  -267,  -267,   481,  -267,   215,  -267,    17,   160,
+    -267,  -267,   174,    46,   164,   -21,   190,   209,   210,   211,
+     247,   -32,   393,  -267,   109,  -267,  -267,   481,   200,    24,
+     -51,  -267,  -267,   184,   184,   184,   226,   223,  -267,   228,
+     184,   128,    88,  -267,   128,   184,  -267,  -267,   120,  -267,
+    -267,   184,   184,   184,  -267,   139,  -267,   224,   232,  -267,
+    -267,  -267,  -267,     9,  -267,  -267,  -267,   184,   159,    35,
+     184,  -267,  -267,   184,   184,   184,   184,   184,   184,   184,
+     184,   184,   184,   184,   184,   184,   184,   184,   184,  -267,
+    -267,  -267,   184,   184,   184,   184,   184,   184,   184,   184,
+     184,   184,   184,  -267,   184,   275,   184,  -267,   236,   223,
+     229,   243,  -267,  -267,   269,  -267,   273,   184,  -267,   274,
+     276,   256,  -267,   277,   266,  -267,   281,   264,    40,  -267,
+     184,   184,   481,   114,  -267,   481,    56,   283,    88,   285,
+      76,   272,   300,  -267,  -267,  -267,   174,   174,    46,    46,
+     164,   164,   164,   164,   -21,   -21,   190,   209,   210,   184,
+     184,   184,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,
+    -267,  -267,  -267,  -267,   288,   271,   184,  -267,   184,  -267,
+     331,   184,   191,   280,  -267,   292,   184,   184,   298,   184,
+     299,   184,   306,   307,  -267,  -267,  -267,  -267,   184,  -267,
+    -267,   184,  -267,   184,   211,   247,     0,  -267,  -267,   295,
+     481,   309,   481,   301,   310,  -267,   481,  -267,   128,   184,
+    -267,  -267,  -267,  -267,  -267,  -267,   313,  -267,   314,   302,
+    -267,   184,  -267,  -267,  -267,  -267,    92,  -267,  -267,  -267,
+     317,   184,  -267,  -267,   184,   318,   184,   128,  -267,  -267,
+     319,  -267,   322,  -267,   308,   324,  -267,   311,  -267,  -267,
+    -267,  -267,   481,  -267,  -267,   400,  -267
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       2,     0,     4,     1,    42,    46,    44,    43,    45,    47,
+       5,     7,     8,     0,     0,    35,    36,    53,    51,    49,
+      48,     0,    54,    55,    50,    56,    11,    82,    59,    83,
+       0,    40,    37,    38,    41,     9,    18,     0,    52,    14,
+      16,    77,    78,    74,    75,    72,    73,    62,    64,    63,
+      65,    66,    67,    68,    69,    70,    71,    76,     0,     0,
+      85,    86,    87,     0,    25,    39,    57,    10,     0,     0,
+       0,    79,    60,    61,     0,     0,    19,    59,    56,     0,
+      34,     0,    27,    29,    32,    59,    58,     0,    17,    15,
+      81,    80,    25,   129,    21,    86,    88,    31,    22,    28,
+       0,     0,    33,     0,     0,    89,     0,    30,    61,     6,
+      84,     0,    23,     0,     0,   103,     0,     0,     0,     0,
+       0,     0,     0,   223,     0,   113,    57,   117,   143,     0,
+       0,     0,     0,   141,   142,   128,     0,     0,     0,     0,
+       0,   130,     0,   147,   144,    91,     0,    35,   138,    90,
+     100,    92,    96,    99,     0,   133,     0,   160,   163,   166,
+     173,   175,   179,   182,   185,   190,   193,   195,   197,   199,
+     202,   205,   209,   221,     0,    93,   125,     0,     0,   147,
+       0,   137,   126,   223,     0,     0,     0,   224,   226,     0,
+       0,     0,     0,   154,     0,     0,   167,   168,   148,   139,
+     170,     0,   238,   232,    59,     0,   169,     0,     0,   172,
+     171,   122,    59,     0,   101,    97,   134,   229,    57,     0,
+     223,   164,   165,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   200,
+     203,   206,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    98,     0,     0,     0,   135,     0,   225,
+       0,     0,   124,   127,     0,   114,   156,     0,   118,     0,
+       0,     0,   236,   239,     0,   227,   233,     0,     0,   149,
+       0,   229,     0,     0,   140,     0,   230,     0,     0,     0,
+     224,     0,     0,   176,   177,   178,   180,   181,   183,   184,
+     188,   189,   186,   187,   191,   192,   194,   196,   198,     0,
+       0,     0,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,   220,   210,   222,     0,     0,   223,    94,     0,   106,
+       0,   229,     0,   131,   120,     0,     0,   240,     0,   234,
+       0,     0,     0,     0,   123,    24,   102,   231,     0,   150,
+     159,   229,   161,   223,   201,   204,     0,   104,   136,     0,
+       0,     0,     0,     0,     0,   155,     0,   119,     0,   229,
+     235,   237,   146,   228,   145,   174,     0,   151,     0,     0,
+     207,     0,   108,    95,   111,   107,     0,   157,   132,   121,
+       0,   229,   158,   162,     0,     0,   223,     0,    13,    12,
+       0,   153,     0,   208,     0,     0,   112,     0,   152,   105,
+     109,   115,     0,    89,   110,     0,   116
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -267,  -267,  -267,  -267,  -267,  -267,   -13,  -267,   -20,   -45,
+     -12,  -267,  -267,  -267,  -267,  -267,   293,  -267,   297,   321,
+     403,  -267,    26,   414,    62,     6,  -116,   -76,   350,  -267,
+      -5,   408,   362,   238,    38,  -267,  -267,  -267,  -174,   304,
+    -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,
+    -267,  -267,  -267,  -267,   -74,  -267,  -267,  -267,   312,  -267,
+    -267,  -267,  -267,  -267,  -267,  -101,    51,    52,    -2,    48,
+     216,   217,   218,   144,   154,  -267,  -267,  -267,    61,  -267,
+    -267,  -112,  -121,  -178,  -172,  -208,   262,  -266,  -267,   122,
+    -267,  -267
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,     2,     4,    10,    66,   179,   400,    38,    39,
+     144,    11,    12,    75,   106,   145,    81,    82,    83,    84,
+     146,    32,    14,   147,    16,    85,    87,    59,    60,    29,
+     148,    95,    62,    63,   111,   149,   150,   360,   151,   152,
+     285,   177,   381,   362,   396,   412,   397,   191,   330,   413,
+     194,   333,   368,   282,   153,   105,   367,   154,   155,   156,
+     157,   267,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   309,   171,   310,   172,   311,
+     394,   173,   174,   188,   260,   189,   286,   287,   277,   272,
+     273,   274
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      27,    94,   187,   255,   180,   258,    40,   256,    30,   101,
+     192,    21,   292,   261,   240,   343,   205,    68,   264,    28,
+     230,   231,    67,   269,    89,    40,    21,     3,    17,   196,
+     197,    18,   112,    19,    35,   200,    20,   206,   257,   209,
+      33,   210,    64,    22,    70,    23,    73,    24,   291,   -20,
+      78,    80,   218,   219,    74,    26,    79,    40,    65,   241,
+     232,   233,   187,   259,   259,   364,    80,   103,    72,   259,
+      26,    71,   -82,   254,   259,    40,    34,    69,    69,    80,
+      88,   -82,   -40,    26,    26,   378,   -82,    80,   108,   380,
+     271,   275,   -40,    99,    34,   -82,    26,    72,   143,   290,
+     270,   220,   288,   390,   211,   275,   -40,   100,   344,   186,
+     -40,   346,   341,   -40,    72,   347,   226,   265,   359,   198,
+     268,   227,   293,   294,   295,   402,   208,   199,   278,   348,
+     312,   313,   314,   315,   316,   317,   318,   319,   320,   321,
+     322,   143,   323,   204,   325,   379,   332,   266,    36,   254,
+      76,   398,   212,    26,    77,    17,   361,    26,    18,    37,
+      19,  -225,    -3,    20,   143,     5,    21,   207,    86,   275,
+      22,     5,    23,    91,    24,     6,    90,    25,   253,   342,
+      40,     6,   254,   345,   109,    69,   383,    77,   385,     7,
+     356,   -82,   388,     8,    92,    31,     9,   221,   222,     8,
+      27,    21,     9,   228,   229,   187,   289,   259,   284,   395,
+      26,   279,   254,   126,   178,    93,   128,   -26,   405,   275,
+      98,   130,   131,   110,   370,   271,   175,   373,   300,   301,
+     302,   303,   187,   234,   235,   176,   373,   214,   414,   275,
+     375,   132,   -41,   350,    36,    26,   133,   134,   223,   182,
+     224,   225,   -41,   183,   136,   137,   181,   275,   184,   138,
+     259,   213,   139,   365,   254,   185,   -41,   140,   190,   143,
+     -41,   193,   143,   -41,   142,   187,    40,   296,   297,   275,
+     298,   299,   304,   305,   195,    17,   217,   236,    18,   237,
+      19,   238,   239,    20,   389,   262,   254,   263,   280,   324,
+      22,   327,    23,   281,    24,   326,   113,    25,     5,   114,
+     115,   -42,   328,   116,   -42,   117,   -42,   118,     6,   -42,
+     119,   120,    21,   406,   121,   122,   -42,   123,   -42,   124,
+     -42,   125,     7,   -42,   126,   127,     8,   128,   129,     9,
+      26,   329,   130,   131,   331,   336,   334,   143,   335,   143,
+     337,   338,   340,   143,   339,   349,   351,   352,   353,   357,
+     358,   363,   132,   369,   382,    36,    26,   133,   134,   366,
+     372,   374,   386,   399,   135,   136,   137,   409,   376,   377,
+     138,   384,   387,   139,   391,   104,   392,   393,   140,   401,
+     404,   407,    93,   141,   408,   142,   410,   107,   411,   143,
+      97,   113,   143,     5,   114,   115,   -42,    13,   116,   -42,
+     117,   -42,   118,     6,   -42,   119,   120,    21,    15,   121,
+     122,   -42,   123,   -42,   124,   -42,   125,     7,   -42,   126,
+     127,     8,   128,   129,     9,   102,    61,   130,   131,    96,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+     283,   415,   306,   354,   307,   403,   308,   132,   215,   371,
+      36,    26,   133,   134,   355,   276,   216,     0,     0,   135,
+     136,   137,     0,     0,     0,   138,     0,     0,   139,   252,
+       0,     0,     0,   140,     0,   114,   115,    93,   416,   116,
+     142,   117,     0,   118,     0,     0,   119,   120,    21,     0,
+     121,   122,     0,   123,     0,   124,     0,   125,     0,     0,
+     126,   127,    17,   128,   129,    18,     0,    19,   130,   131,
+      20,     0,     0,     0,     0,     0,     0,    22,     0,    23,
+       0,    24,     0,     0,    25,     0,     0,     0,   132,     0,
+      79,    36,    26,   133,   134,     0,     0,     0,     0,     0,
+     135,   136,   137,     0,     0,    17,   138,     0,    18,   139,
+      19,     0,     0,    20,   140,     0,    21,    26,    93,     0,
+      22,   142,    23,     0,    24,     0,     0,    25,   126,   178,
+      17,   128,     0,    18,     0,    19,   130,   131,    20,     0,
+       0,     0,     0,     0,     0,    22,     0,    23,     0,    24,
+       0,     0,    25,     0,     0,     0,   132,     0,     0,    36,
+      26,   133,   134,    41,    42,    43,    44,    45,    46,   136,
+     137,     0,     0,   201,   138,     0,     0,   139,     0,     0,
+       0,     0,   140,   202,     0,     0,   203,     0,     0,   142,
+       0,     0,     0,     0,     0,     0,    47,     0,     0,     0,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58
+};
+
+static const yytype_int16 yycheck[] =
+{
+      13,    75,   123,   177,   116,   183,    18,    58,    13,    85,
+     126,    17,   220,   185,    46,   281,   137,    37,   190,    13,
+      41,    42,    35,   195,    69,    37,    17,     0,     6,   130,
+     131,     9,   106,    11,    18,   136,    14,   138,    89,   140,
+      14,   142,    71,    21,    58,    23,    59,    25,   220,    87,
+      28,    64,    35,    36,    59,    61,    34,    69,    32,    91,
+      81,    82,   183,   184,   185,   331,    79,    87,    74,   190,
+      61,    85,    57,    73,   195,    87,    14,    70,    70,    92,
+      72,    57,     3,    61,    61,   351,    71,   100,   101,    89,
+     202,   203,    13,    59,    32,    71,    61,    74,   111,   220,
+     201,    84,   218,   369,    89,   217,    27,    73,   282,   122,
+      31,   285,    72,    34,    74,    59,    70,   191,   326,   132,
+     194,    75,   223,   224,   225,   391,   139,   132,   204,    73,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+     252,   154,   254,   137,   256,   353,   267,   192,    60,    73,
+      69,    59,   146,    61,    73,     6,   328,    61,     9,    71,
+      11,    85,     0,    14,   177,     3,    17,    71,     9,   281,
+      21,     3,    23,    86,    25,    13,    85,    28,    69,   280,
+     192,    13,    73,    69,    69,    70,   360,    73,   362,    27,
+     311,    71,   366,    31,    71,    27,    34,    37,    38,    31,
+     213,    17,    34,    39,    40,   326,   219,   328,   213,   381,
+      61,    72,    73,    29,    30,    87,    32,    72,   396,   331,
+      72,    37,    38,    72,   336,   337,    69,   339,   230,   231,
+     232,   233,   353,    43,    44,    69,   348,     7,   412,   351,
+     341,    57,     3,   288,    60,    61,    62,    63,    74,    69,
+      76,    77,    13,    71,    70,    71,    89,   369,    71,    75,
+     381,    57,    78,    72,    73,    71,    27,    83,    71,   282,
+      31,    71,   285,    34,    90,   396,   288,   226,   227,   391,
+     228,   229,   234,   235,    71,     6,    71,    78,     9,    79,
+      11,    80,    45,    14,   368,    69,    73,    69,    74,    24,
+      21,    72,    23,    71,    25,    69,     1,    28,     3,     4,
+       5,     6,    69,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,   397,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      61,    72,    37,    38,    71,    89,    72,   360,    72,   362,
+      73,    85,    88,   366,    73,    72,    71,    85,    58,    71,
+      89,    30,    57,    71,    69,    60,    61,    62,    63,    89,
+      72,    72,    71,   386,    69,    70,    71,    69,    72,    72,
+      75,    72,    72,    78,    71,    92,    72,    85,    83,    72,
+      72,    72,    87,    88,    72,    90,    72,   100,    87,   412,
+      79,     1,   415,     3,     4,     5,     6,     4,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,     4,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    85,    28,    37,    38,    77,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+     212,   413,   236,   309,   237,   394,   238,    57,   154,   337,
+      60,    61,    62,    63,   310,   203,   154,    -1,    -1,    69,
+      70,    71,    -1,    -1,    -1,    75,    -1,    -1,    78,    86,
+      -1,    -1,    -1,    83,    -1,     4,     5,    87,    88,     8,
+      90,    10,    -1,    12,    -1,    -1,    15,    16,    17,    -1,
+      19,    20,    -1,    22,    -1,    24,    -1,    26,    -1,    -1,
+      29,    30,     6,    32,    33,     9,    -1,    11,    37,    38,
+      14,    -1,    -1,    -1,    -1,    -1,    -1,    21,    -1,    23,
+      -1,    25,    -1,    -1,    28,    -1,    -1,    -1,    57,    -1,
+      34,    60,    61,    62,    63,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    71,    -1,    -1,     6,    75,    -1,     9,    78,
+      11,    -1,    -1,    14,    83,    -1,    17,    61,    87,    -1,
+      21,    90,    23,    -1,    25,    -1,    -1,    28,    29,    30,
+       6,    32,    -1,     9,    -1,    11,    37,    38,    14,    -1,
+      -1,    -1,    -1,    -1,    -1,    21,    -1,    23,    -1,    25,
+      -1,    -1,    28,    -1,    -1,    -1,    57,    -1,    -1,    60,
+      61,    62,    63,    37,    38,    39,    40,    41,    42,    70,
+      71,    -1,    -1,    74,    75,    -1,    -1,    78,    -1,    -1,
+      -1,    -1,    83,    84,    -1,    -1,    87,    -1,    -1,    90,
+      -1,    -1,    -1,    -1,    -1,    -1,    70,    -1,    -1,    -1,
+      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
+      84
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,    93,    94,     0,    95,     3,    13,    27,    31,    34,
+      96,   103,   104,   112,   114,   115,   116,     6,     9,    11,
+      14,    17,    21,    23,    25,    28,    61,    98,   117,   121,
+     122,    27,   113,   114,   116,    18,    60,    71,   100,   101,
+     102,    37,    38,    39,    40,    41,    42,    70,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,   119,
+     120,   123,   124,   125,    71,   114,    97,    98,   100,    70,
+      58,    85,    74,    98,   122,   105,    69,    73,    28,    34,
+      98,   108,   109,   110,   111,   117,     9,   118,    72,   101,
+      85,    86,    71,    87,   146,   123,   124,   111,    72,    59,
+      73,   119,   120,   100,   108,   147,   106,   110,    98,    69,
+      72,   126,   146,     1,     4,     5,     8,    10,    12,    15,
+      16,    19,    20,    22,    24,    26,    29,    30,    32,    33,
+      37,    38,    57,    62,    63,    69,    70,    71,    75,    78,
+      83,    88,    90,    98,   102,   107,   112,   115,   122,   127,
+     128,   130,   131,   146,   149,   150,   151,   152,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   168,   170,   173,   174,    69,    69,   133,    30,    98,
+     173,    89,    69,    71,    71,    71,    98,   174,   175,   177,
+      71,   139,   118,    71,   142,    71,   157,   157,    98,   122,
+     157,    74,    84,    87,   117,   174,   157,    71,    98,   157,
+     157,    89,   117,    57,     7,   131,   150,    71,    35,    36,
+      84,    37,    38,    74,    76,    77,    70,    75,    39,    40,
+      41,    42,    81,    82,    43,    44,    78,    79,    80,    45,
+      46,    91,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    86,    69,    73,   130,    58,    89,   175,   174,
+     176,   176,    69,    69,   176,   146,   101,   153,   146,   176,
+     157,   173,   181,   182,   183,   173,   178,   180,   119,    72,
+      74,    71,   145,   125,   122,   132,   178,   179,   118,    98,
+     174,   176,   177,   157,   157,   157,   158,   158,   159,   159,
+     160,   160,   160,   160,   161,   161,   162,   163,   164,   167,
+     169,   171,   173,   173,   173,   173,   173,   173,   173,   173,
+     173,   173,   173,   173,    24,   173,    69,    72,    69,    72,
+     140,    71,   174,   143,    72,    72,    89,    73,    85,    73,
+      88,    72,   157,   179,   130,    69,   130,    59,    73,    72,
+     101,    71,    85,    58,   165,   166,   174,    71,    89,   177,
+     129,   176,   135,    30,   179,    72,    89,   148,   144,    71,
+     173,   181,    72,   173,    72,   157,    72,    72,   179,   177,
+      89,   134,    69,   130,    72,   130,    71,    72,   130,   146,
+     179,    71,    72,    85,   172,   176,   136,   138,    59,    98,
+      99,    72,   179,   170,    72,   175,   146,    72,    72,    69,
+      72,    87,   137,   141,   130,   126,    88
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    92,    94,    93,    95,    95,    96,    96,    96,    97,
+      97,    98,    99,    99,   100,   100,   101,   101,   102,   103,
+     105,   104,   106,   104,   107,   108,   108,   108,   108,   109,
+     109,   110,   110,   111,   111,   112,   112,   112,   113,   113,
+     114,   114,   115,   115,   116,   116,   116,   116,   117,   117,
+     117,   117,   117,   117,   117,   117,   117,   118,   118,   119,
+     119,   120,   121,   121,   121,   121,   121,   121,   121,   121,
+     121,   121,   121,   121,   121,   121,   121,   121,   121,   121,
+     121,   121,   122,   122,   123,   124,   124,   125,   125,   126,
+     126,   127,   127,   127,   129,   128,   130,   130,   131,   131,
+     131,   132,   131,   133,   134,   131,   135,   131,   136,   137,
+     131,   138,   131,   139,   140,   141,   131,   142,   143,   131,
+     144,   131,   145,   131,   131,   131,   131,   131,   131,   147,
+     146,   148,   148,   149,   149,   150,   150,   150,   151,   151,
+     151,   152,   152,   152,   152,   152,   152,   152,   152,   152,
+     152,   152,   152,   152,   153,   152,   152,   152,   152,   152,
+     154,   154,   154,   155,   155,   155,   156,   156,   156,   156,
+     156,   156,   156,   157,   157,   158,   158,   158,   158,   159,
+     159,   159,   160,   160,   160,   161,   161,   161,   161,   161,
+     162,   162,   162,   163,   163,   164,   164,   165,   165,   166,
+     167,   166,   168,   169,   168,   170,   171,   172,   170,   173,
+     173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
+     173,   174,   174,   175,   175,   176,   177,   178,   178,   179,
+     179,   179,   180,   180,   180,   181,   182,   182,   183,   183,
+     183
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     0,     2,     6,     1,     1,     0,
+       1,     1,     1,     1,     1,     3,     1,     3,     1,     4,
+       0,     5,     0,     7,     4,     0,     1,     1,     2,     1,
+       3,     2,     1,     2,     1,     1,     1,     2,     1,     2,
+       1,     1,     0,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     2,     1,     1,     1,     1,     0,     1,     0,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     3,
+       4,     4,     1,     1,     5,     1,     1,     1,     3,     0,
+       2,     1,     1,     2,     0,     6,     1,     2,     2,     1,
+       1,     0,     4,     0,     0,     9,     0,     6,     0,     0,
+      11,     0,     8,     0,     0,     0,    12,     0,     0,     5,
+       0,     6,     0,     4,     3,     2,     2,     3,     1,     0,
+       4,     0,     2,     1,     2,     3,     5,     2,     1,     2,
+       3,     1,     1,     1,     1,     5,     5,     1,     2,     3,
+       4,     5,     8,     7,     0,     5,     3,     6,     6,     4,
+       1,     4,     6,     1,     2,     2,     1,     2,     2,     2,
+       2,     2,     2,     1,     5,     1,     3,     3,     3,     1,
+       3,     3,     1,     3,     3,     1,     3,     3,     3,     3,
+       1,     3,     3,     1,     3,     1,     3,     1,     3,     1,
+       0,     4,     1,     0,     4,     1,     0,     0,     7,     1,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     1,     3,     0,     1,     1,     1,     1,     3,     0,
+       1,     2,     0,     1,     2,     3,     1,     3,     0,     1,
+       2
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* $@1: %empty  */
+#line 140 "parser.y"
+                {
+		  nerrors = 0;
+		  ndeclarations = 0;
+		}
+#line 1861 "y.tab.c"
+    break;
+
+  case 3: /* program: $@1 top_level_declarations  */
+#line 145 "parser.y"
+                {
+		  if (nerrors > 0) {
+		      YYABORT;
+		  }
+		}
+#line 1871 "y.tab.c"
+    break;
+
+  case 5: /* top_level_declarations: top_level_declarations top_level_declaration  */
+#line 155 "parser.y"
+                {
+		  if (nerrors > 0) {
+		      YYABORT;
+		  }
+		}
+#line 1881 "y.tab.c"
+    break;
+
+  case 6: /* top_level_declaration: opt_private INHERIT opt_inherit_label opt_object composite_string ';'  */
+#line 164 "parser.y"
+                {
+		  if (ndeclarations > 0) {
+		      Compile::error("inherit must precede all declarations");
+		  } else if (nerrors > 0 ||
+			     !Compile::inherit((yyvsp[-1].node)->l.string->text, (yyvsp[-3].node), (yyvsp[-5].type) != 0))
+		  {
+		      /*
+		       * The object to be inherited may have been compiled;
+		       * abort this compilation and possibly restart later.
+		       */
+		      YYABORT;
+		  }
+		}
+#line 1899 "y.tab.c"
+    break;
+
+  case 7: /* top_level_declaration: data_declaration  */
+#line 178 "parser.y"
+                { ndeclarations++; }
+#line 1905 "y.tab.c"
+    break;
+
+  case 8: /* top_level_declaration: function_declaration  */
+#line 180 "parser.y"
+                { ndeclarations++; }
+#line 1911 "y.tab.c"
+    break;
+
+  case 9: /* opt_inherit_label: %empty  */
+#line 185 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 1917 "y.tab.c"
+    break;
+
+  case 11: /* ident: IDENTIFIER  */
+#line 191 "parser.y"
+                { (yyval.node) = Node::createStr(String::create(yytext, yyleng)); }
+#line 1923 "y.tab.c"
+    break;
+
+  case 13: /* exception: ELLIPSIS  */
+#line 197 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 1929 "y.tab.c"
+    break;
+
+  case 15: /* composite_string: composite_string '+' string_exp  */
+#line 203 "parser.y"
+                { (yyval.node) = Node::createStr((yyvsp[-2].node)->l.string->add((yyvsp[0].node)->l.string)); }
+#line 1935 "y.tab.c"
+    break;
+
+  case 17: /* string_exp: '(' composite_string ')'  */
+#line 209 "parser.y"
+                { (yyval.node) = (yyvsp[-1].node); }
+#line 1941 "y.tab.c"
+    break;
+
+  case 18: /* string: STRING_CONST  */
+#line 214 "parser.y"
+                { (yyval.node) = Node::createStr(String::create(yytext, yyleng)); }
+#line 1947 "y.tab.c"
+    break;
+
+  case 19: /* data_declaration: class_specifier_list type_specifier list_dcltr ';'  */
+#line 219 "parser.y"
+                { Compile::global((yyvsp[-3].type), (yyvsp[-2].node), (yyvsp[-1].node)); }
+#line 1953 "y.tab.c"
+    break;
+
+  case 20: /* $@2: %empty  */
+#line 224 "parser.y"
+                {
+		  typechecking = TRUE;
+		  Compile::function((yyvsp[-2].type), (yyvsp[-1].node), (yyvsp[0].node));
+		}
+#line 1962 "y.tab.c"
+    break;
+
+  case 21: /* function_declaration: class_specifier_list type_specifier function_dcltr $@2 compound_stmt  */
+#line 229 "parser.y"
+                {
+		  if (nerrors == 0) {
+		      Compile::funcbody((yyvsp[0].node));
+		  }
+		}
+#line 1972 "y.tab.c"
+    break;
+
+  case 22: /* $@3: %empty  */
+#line 235 "parser.y"
+                {
+		  typechecking = Compile::typechecking();
+		  Compile::function((yyvsp[-4].type), Node::createType((typechecking) ?
+							  T_VOID : T_NIL,
+							 (String *) NULL),
+			     Node::createBin(N_FUNC, 0, (yyvsp[-3].node), (yyvsp[-1].node)));
+		}
+#line 1984 "y.tab.c"
+    break;
+
+  case 23: /* function_declaration: class_specifier_list function_name '(' formals_declaration ')' $@3 compound_stmt  */
+#line 243 "parser.y"
+                {
+		  if (nerrors == 0) {
+		      Compile::funcbody((yyvsp[0].node));
+		  }
+		}
+#line 1994 "y.tab.c"
+    break;
+
+  case 24: /* local_data_declaration: class_specifier_list type_specifier list_dcltr ';'  */
+#line 252 "parser.y"
+                { Compile::local((yyvsp[-3].type), (yyvsp[-2].node), (yyvsp[-1].node)); }
+#line 2000 "y.tab.c"
+    break;
+
+  case 25: /* formals_declaration: %empty  */
+#line 257 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 2006 "y.tab.c"
+    break;
+
+  case 26: /* formals_declaration: VOID  */
+#line 258 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 2012 "y.tab.c"
+    break;
+
+  case 28: /* formals_declaration: formal_declaration_list ELLIPSIS  */
+#line 261 "parser.y"
+                {
+		  (yyval.node) = (yyvsp[-1].node);
+		  (yyval.node)->flags |= F_ELLIPSIS;
+		}
+#line 2021 "y.tab.c"
+    break;
+
+  case 30: /* formal_declaration_list: formal_declaration_list ',' varargs_formal_declaration  */
+#line 270 "parser.y"
+                { (yyval.node) = Node::createBin(N_PAIR, 0, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 2027 "y.tab.c"
+    break;
+
+  case 31: /* varargs_formal_declaration: VARARGS formal_declaration  */
+#line 275 "parser.y"
+                {
+		  (yyval.node) = (yyvsp[0].node);
+		  (yyval.node)->flags |= F_VARARGS;
+		}
+#line 2036 "y.tab.c"
+    break;
+
+  case 33: /* formal_declaration: type_specifier data_dcltr  */
+#line 284 "parser.y"
+                {
+		  (yyval.node) = (yyvsp[0].node);
+		  (yyval.node)->mod |= (yyvsp[-1].node)->mod;
+		  (yyval.node)->sclass = (yyvsp[-1].node)->sclass;
+		  if ((yyval.node)->sclass != (String *) NULL) {
+		      (yyval.node)->sclass->ref();
+		  }
+		}
+#line 2049 "y.tab.c"
+    break;
+
+  case 34: /* formal_declaration: ident  */
+#line 292 "parser.y"
+                {
+		  (yyval.node) = (yyvsp[0].node);
+		  (yyval.node)->mod = T_NIL;	/* only if typechecking, though */
+		}
+#line 2058 "y.tab.c"
+    break;
+
+  case 37: /* class_specifier_list: class_specifier class_specifier_list2  */
+#line 302 "parser.y"
+                { (yyval.type) = (yyvsp[-1].type) | (yyvsp[0].type); }
+#line 2064 "y.tab.c"
+    break;
+
+  case 39: /* class_specifier_list2: class_specifier_list2 class_specifier  */
+#line 308 "parser.y"
+                { (yyval.type) = (yyvsp[-1].type) | (yyvsp[0].type); }
+#line 2070 "y.tab.c"
+    break;
+
+  case 40: /* class_specifier: PRIVATE  */
+#line 313 "parser.y"
+                { (yyval.type) = C_STATIC | C_PRIVATE; }
+#line 2076 "y.tab.c"
+    break;
+
+  case 42: /* opt_private: %empty  */
+#line 319 "parser.y"
+                { (yyval.type) = 0; }
+#line 2082 "y.tab.c"
+    break;
+
+  case 43: /* opt_private: PRIVATE  */
+#line 321 "parser.y"
+                { (yyval.type) = C_STATIC | C_PRIVATE; }
+#line 2088 "y.tab.c"
+    break;
+
+  case 44: /* non_private: STATIC  */
+#line 326 "parser.y"
+                { (yyval.type) = C_STATIC; }
+#line 2094 "y.tab.c"
+    break;
+
+  case 45: /* non_private: ATOMIC  */
+#line 328 "parser.y"
+                { (yyval.type) = C_ATOMIC; }
+#line 2100 "y.tab.c"
+    break;
+
+  case 46: /* non_private: NOMASK  */
+#line 330 "parser.y"
+                { (yyval.type) = C_NOMASK; }
+#line 2106 "y.tab.c"
+    break;
+
+  case 47: /* non_private: VARARGS  */
+#line 332 "parser.y"
+                { (yyval.type) = C_VARARGS; }
+#line 2112 "y.tab.c"
+    break;
+
+  case 48: /* type_specifier: INT  */
+#line 336 "parser.y"
+                { (yyval.node) = Node::createType(T_INT, (String *) NULL); }
+#line 2118 "y.tab.c"
+    break;
+
+  case 49: /* type_specifier: FLOAT  */
+#line 337 "parser.y"
+                { (yyval.node) = Node::createType(T_FLOAT, (String *) NULL); }
+#line 2124 "y.tab.c"
+    break;
+
+  case 50: /* type_specifier: STRING  */
+#line 339 "parser.y"
+                { (yyval.node) = Node::createType(T_STRING, (String *) NULL); }
+#line 2130 "y.tab.c"
+    break;
+
+  case 51: /* type_specifier: OBJECT  */
+#line 341 "parser.y"
+                { (yyval.node) = Node::createType(T_OBJECT, (String *) NULL); }
+#line 2136 "y.tab.c"
+    break;
+
+  case 52: /* type_specifier: OBJECT composite_string  */
+#line 343 "parser.y"
+                { (yyval.node) = Node::createType(T_CLASS, Compile::objecttype((yyvsp[0].node))); }
+#line 2142 "y.tab.c"
+    break;
+
+  case 53: /* type_specifier: MAPPING  */
+#line 345 "parser.y"
+                { (yyval.node) = Node::createType(T_MAPPING, (String *) NULL); }
+#line 2148 "y.tab.c"
+    break;
+
+  case 54: /* type_specifier: FUNCTION  */
+#line 347 "parser.y"
+                {
+		  (yyval.node) = Node::createStr(String::create("/" BIPREFIX "function",
+						      BIPREFIXLEN + 9));
+		  (yyval.node) = Node::createType(T_CLASS, Compile::objecttype((yyval.node)));
+		}
+#line 2158 "y.tab.c"
+    break;
+
+  case 55: /* type_specifier: MIXED  */
+#line 352 "parser.y"
+                { (yyval.node) = Node::createType(T_MIXED, (String *) NULL); }
+#line 2164 "y.tab.c"
+    break;
+
+  case 56: /* type_specifier: VOID  */
+#line 353 "parser.y"
+                { (yyval.node) = Node::createType(T_VOID, (String *) NULL); }
+#line 2170 "y.tab.c"
+    break;
+
+  case 59: /* star_list: %empty  */
+#line 363 "parser.y"
+                { (yyval.type) = 0; }
+#line 2176 "y.tab.c"
+    break;
+
+  case 60: /* star_list: star_list '*'  */
+#line 365 "parser.y"
+                {
+		  (yyval.type) = (yyvsp[-1].type) + 1;
+		  if ((yyval.type) == 1 << (8 - REFSHIFT)) {
+		      Compile::error("too deep indirection");
+		  }
+		}
+#line 2187 "y.tab.c"
+    break;
+
+  case 61: /* data_dcltr: star_list ident  */
+#line 375 "parser.y"
+                {
+		  (yyval.node) = (yyvsp[0].node);
+		  (yyval.node)->mod = ((yyvsp[-1].type) << REFSHIFT) & T_REF;
+		}
+#line 2196 "y.tab.c"
+    break;
+
+  case 62: /* operator: OPERATOR '+'  */
+#line 383 "parser.y"
+                { (yyval.node) = Node::createOp("+"); }
+#line 2202 "y.tab.c"
+    break;
+
+  case 63: /* operator: OPERATOR '-'  */
+#line 385 "parser.y"
+                { (yyval.node) = Node::createOp("-"); }
+#line 2208 "y.tab.c"
+    break;
+
+  case 64: /* operator: OPERATOR '*'  */
+#line 387 "parser.y"
+                { (yyval.node) = Node::createOp("*"); }
+#line 2214 "y.tab.c"
+    break;
+
+  case 65: /* operator: OPERATOR '/'  */
+#line 389 "parser.y"
+                { (yyval.node) = Node::createOp("/"); }
+#line 2220 "y.tab.c"
+    break;
+
+  case 66: /* operator: OPERATOR '%'  */
+#line 391 "parser.y"
+                { (yyval.node) = Node::createOp("%"); }
+#line 2226 "y.tab.c"
+    break;
+
+  case 67: /* operator: OPERATOR '&'  */
+#line 393 "parser.y"
+                { (yyval.node) = Node::createOp("&"); }
+#line 2232 "y.tab.c"
+    break;
+
+  case 68: /* operator: OPERATOR '^'  */
+#line 395 "parser.y"
+                { (yyval.node) = Node::createOp("^"); }
+#line 2238 "y.tab.c"
+    break;
+
+  case 69: /* operator: OPERATOR '|'  */
+#line 397 "parser.y"
+                { (yyval.node) = Node::createOp("|"); }
+#line 2244 "y.tab.c"
+    break;
+
+  case 70: /* operator: OPERATOR '<'  */
+#line 399 "parser.y"
+                { (yyval.node) = Node::createOp("<"); }
+#line 2250 "y.tab.c"
+    break;
+
+  case 71: /* operator: OPERATOR '>'  */
+#line 401 "parser.y"
+                { (yyval.node) = Node::createOp(">"); }
+#line 2256 "y.tab.c"
+    break;
+
+  case 72: /* operator: OPERATOR LE  */
+#line 403 "parser.y"
+                { (yyval.node) = Node::createOp("<="); }
+#line 2262 "y.tab.c"
+    break;
+
+  case 73: /* operator: OPERATOR GE  */
+#line 405 "parser.y"
+                { (yyval.node) = Node::createOp(">="); }
+#line 2268 "y.tab.c"
+    break;
+
+  case 74: /* operator: OPERATOR LSHIFT  */
+#line 407 "parser.y"
+                { (yyval.node) = Node::createOp("<<"); }
+#line 2274 "y.tab.c"
+    break;
+
+  case 75: /* operator: OPERATOR RSHIFT  */
+#line 409 "parser.y"
+                { (yyval.node) = Node::createOp(">>"); }
+#line 2280 "y.tab.c"
+    break;
+
+  case 76: /* operator: OPERATOR '~'  */
+#line 411 "parser.y"
+                { (yyval.node) = Node::createOp("~"); }
+#line 2286 "y.tab.c"
+    break;
+
+  case 77: /* operator: OPERATOR PLUS_PLUS  */
+#line 413 "parser.y"
+                { (yyval.node) = Node::createOp("++"); }
+#line 2292 "y.tab.c"
+    break;
+
+  case 78: /* operator: OPERATOR MIN_MIN  */
+#line 415 "parser.y"
+                { (yyval.node) = Node::createOp("--"); }
+#line 2298 "y.tab.c"
+    break;
+
+  case 79: /* operator: OPERATOR '[' ']'  */
+#line 417 "parser.y"
+                { (yyval.node) = Node::createOp("[]"); }
+#line 2304 "y.tab.c"
+    break;
+
+  case 80: /* operator: OPERATOR '[' ']' '='  */
+#line 419 "parser.y"
+                { (yyval.node) = Node::createOp("[]="); }
+#line 2310 "y.tab.c"
+    break;
+
+  case 81: /* operator: OPERATOR '[' DOT_DOT ']'  */
+#line 421 "parser.y"
+                { (yyval.node) = Node::createOp("[..]"); }
+#line 2316 "y.tab.c"
+    break;
+
+  case 84: /* function_dcltr: star_list function_name '(' formals_declaration ')'  */
+#line 431 "parser.y"
+                {
+		  (yyval.node) = Node::createBin(N_FUNC, ((yyvsp[-4].type) << REFSHIFT) & T_REF, (yyvsp[-3].node),
+				       (yyvsp[-1].node));
+		}
+#line 2325 "y.tab.c"
+    break;
+
+  case 88: /* list_dcltr: list_dcltr ',' dcltr  */
+#line 445 "parser.y"
+                { (yyval.node) = Node::createBin(N_PAIR, 0, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 2331 "y.tab.c"
+    break;
+
+  case 89: /* dcltr_or_stmt_list: %empty  */
+#line 450 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 2337 "y.tab.c"
+    break;
+
+  case 90: /* dcltr_or_stmt_list: dcltr_or_stmt_list dcltr_or_stmt  */
+#line 452 "parser.y"
+                { (yyval.node) = Compile::concat((yyvsp[-1].node), (yyvsp[0].node)); }
+#line 2343 "y.tab.c"
+    break;
+
+  case 91: /* dcltr_or_stmt: local_data_declaration  */
+#line 457 "parser.y"
+                {
+		  if (nstatements > 0) {
+		      Compile::error("declaration after statement");
+		  }
+		  (yyval.node) = (Node *) NULL;
+		}
+#line 2354 "y.tab.c"
+    break;
+
+  case 92: /* dcltr_or_stmt: stmt  */
+#line 463 "parser.y"
+                {
+		  nstatements++;
+		  (yyval.node) = (yyvsp[0].node);
+		}
+#line 2363 "y.tab.c"
+    break;
+
+  case 93: /* dcltr_or_stmt: error ';'  */
+#line 468 "parser.y"
+                {
+		  if (nerrors >= MAX_ERRORS) {
+		      YYABORT;
+		  }
+		  (yyval.node) = (Node *) NULL;
+		}
+#line 2374 "y.tab.c"
+    break;
+
+  case 94: /* $@4: %empty  */
+#line 478 "parser.y"
+                { Compile::startCond(); }
+#line 2380 "y.tab.c"
+    break;
+
+  case 95: /* if_stmt: IF '(' f_list_exp ')' $@4 stmt  */
+#line 479 "parser.y"
+                { (yyval.node) = Compile::ifStmt((yyvsp[-3].node), (yyvsp[0].node)); }
+#line 2386 "y.tab.c"
+    break;
+
+  case 97: /* stmt: case_list nocase_stmt  */
+#line 485 "parser.y"
+                {
+		  if ((yyvsp[-1].node) != NULL) {
+		      (yyval.node) = (yyvsp[-1].node);
+		      (yyval.node)->r.right->l.left = (yyvsp[0].node);
+		  } else {
+		      (yyval.node) = (yyvsp[0].node);
+		  }
+		}
+#line 2399 "y.tab.c"
+    break;
+
+  case 98: /* nocase_stmt: list_exp ';'  */
+#line 497 "parser.y"
+                { (yyval.node) = Compile::exprStmt((yyvsp[-1].node)); }
+#line 2405 "y.tab.c"
+    break;
+
+  case 100: /* nocase_stmt: if_stmt  */
+#line 500 "parser.y"
+                {
+		  Compile::endCond();
+		  (yyval.node) = Compile::endIfStmt((yyvsp[0].node), (Node *) NULL);
+		}
+#line 2414 "y.tab.c"
+    break;
+
+  case 101: /* $@5: %empty  */
+#line 506 "parser.y"
+                { Compile::startCond2(); }
+#line 2420 "y.tab.c"
+    break;
+
+  case 102: /* nocase_stmt: if_stmt ELSE $@5 stmt  */
+#line 508 "parser.y"
+                {
+		  if ((yyvsp[-3].node) != (Node *) NULL && (yyvsp[0].node) != (Node *) NULL) {
+		      if (!(((yyvsp[-3].node)->flags | (yyvsp[0].node)->flags) & F_END)) {
+			  Compile::matchCond();
+			  Compile::saveCond();
+		      } else if (!((yyvsp[0].node)->flags & F_END)) {
+			  Compile::saveCond();
+			  Compile::saveCond();
+		      } else {
+			  Compile::endCond();
+			  if (!((yyvsp[-3].node)->flags & F_END)) {
+			      Compile::saveCond();
+			  } else {
+			      Compile::endCond();
+			  }
+		      }
+		  } else {
+		      Compile::endCond();
+		      Compile::endCond();
+		  }
+		  (yyval.node) = Compile::endIfStmt((yyvsp[-3].node), (yyvsp[0].node));
+		}
+#line 2447 "y.tab.c"
+    break;
+
+  case 103: /* $@6: %empty  */
+#line 530 "parser.y"
+                {
+		  Compile::loop();
+		  Compile::startCond();
+		}
+#line 2456 "y.tab.c"
+    break;
+
+  case 104: /* $@7: %empty  */
+#line 535 "parser.y"
+                {
+		  Compile::endCond();
+		  Compile::startCond();
+		}
+#line 2465 "y.tab.c"
+    break;
+
+  case 105: /* nocase_stmt: DO $@6 stmt WHILE '(' $@7 f_list_exp ')' ';'  */
+#line 540 "parser.y"
+                {
+		  Compile::endCond();
+		  (yyval.node) = Compile::doStmt((yyvsp[-2].node), (yyvsp[-6].node));
+		}
+#line 2474 "y.tab.c"
+    break;
+
+  case 106: /* $@8: %empty  */
+#line 545 "parser.y"
+                {
+		  Compile::loop();
+		  Compile::startCond();
+		}
+#line 2483 "y.tab.c"
+    break;
+
+  case 107: /* nocase_stmt: WHILE '(' f_list_exp ')' $@8 stmt  */
+#line 549 "parser.y"
+                {
+		  Compile::endCond();
+		  (yyval.node) = Compile::whileStmt((yyvsp[-3].node), (yyvsp[0].node));
+		}
+#line 2492 "y.tab.c"
+    break;
+
+  case 108: /* $@9: %empty  */
+#line 554 "parser.y"
+                { Compile::startCond(); }
+#line 2498 "y.tab.c"
+    break;
+
+  case 109: /* $@10: %empty  */
+#line 556 "parser.y"
+                {
+		  Compile::endCond();
+		  Compile::loop();
+		  Compile::startCond();
+		}
+#line 2508 "y.tab.c"
+    break;
+
+  case 110: /* nocase_stmt: FOR '(' opt_list_exp ';' f_opt_list_exp ';' $@9 opt_list_exp ')' $@10 stmt  */
+#line 561 "parser.y"
+                {
+		  Compile::endCond();
+		  (yyval.node) = Compile::forStmt(Compile::exprStmt((yyvsp[-8].node)), (yyvsp[-6].node),
+					Compile::exprStmt((yyvsp[-3].node)), (yyvsp[0].node));
+		}
+#line 2518 "y.tab.c"
+    break;
+
+  case 111: /* $@11: %empty  */
+#line 567 "parser.y"
+                {
+		  if (typechecking) {
+		      char tnbuf[TNBUFSIZE];
+
+		      if ((yyvsp[-3].node)->mod != T_INT && (yyvsp[-3].node)->mod != T_MIXED) {
+			  Compile::error("bad type for stack rlimit (%s)",
+					 Value::typeName(tnbuf, (yyvsp[-3].node)->mod));
+		      }
+		      if ((yyvsp[-1].node)->mod != T_INT && (yyvsp[-1].node)->mod != T_MIXED) {
+			  Compile::error("bad type for ticks rlimit (%s)",
+				         Value::typeName(tnbuf, (yyvsp[-1].node)->mod));
+		      }
+		  }
+		  Compile::startRlimits();
+		}
+#line 2538 "y.tab.c"
+    break;
+
+  case 112: /* nocase_stmt: RLIMITS '(' f_list_exp ';' f_list_exp ')' $@11 compound_stmt  */
+#line 583 "parser.y"
+                { (yyval.node) = Compile::endRlimits((yyvsp[-5].node), (yyvsp[-3].node), (yyvsp[0].node)); }
+#line 2544 "y.tab.c"
+    break;
+
+  case 113: /* $@12: %empty  */
+#line 584 "parser.y"
+                {
+		  Compile::startCatch();
+		  Compile::startCond();
+		}
+#line 2553 "y.tab.c"
+    break;
+
+  case 114: /* $@13: %empty  */
+#line 589 "parser.y"
+                {
+		  Compile::endCond();
+		  Compile::endCatch();
+		  Compile::startCond();
+		}
+#line 2563 "y.tab.c"
+    break;
+
+  case 115: /* $@14: %empty  */
+#line 595 "parser.y"
+                {
+		  nstatements = 0;
+		  Compile::startCompound();
+		  if ((yyvsp[-2].node) != (Node *) NULL) {
+		      (yyvsp[0].node) = Compile::exprStmt(Compile::exception((yyvsp[-2].node)));
+		  }
+		}
+#line 2575 "y.tab.c"
+    break;
+
+  case 116: /* nocase_stmt: TRY $@12 compound_stmt $@13 CATCH '(' exception ')' '{' $@14 dcltr_or_stmt_list '}'  */
+#line 603 "parser.y"
+                {
+		  nstatements++;
+		  (yyval.node) = Compile::endCompound((yyvsp[-1].node));
+		  Compile::endCond();
+		  if ((yyvsp[-5].node) != (Node *) NULL && (yyval.node) != (Node *) NULL) {
+		      (yyval.node) = Compile::doneCatch((yyvsp[-9].node), Compile::concat((yyvsp[-3].node), (yyval.node)),
+					      FALSE);
+		  } else {
+		      (yyval.node) = Compile::doneCatch((yyvsp[-9].node), (yyval.node), TRUE);
+		  }
+		}
+#line 2591 "y.tab.c"
+    break;
+
+  case 117: /* $@15: %empty  */
+#line 614 "parser.y"
+                {
+		  Compile::startCatch();
+		  Compile::startCond();
+		}
+#line 2600 "y.tab.c"
+    break;
+
+  case 118: /* $@16: %empty  */
+#line 619 "parser.y"
+                {
+		  Compile::endCond();
+		  Compile::endCatch();
+		  Compile::startCond();
+		}
+#line 2610 "y.tab.c"
+    break;
+
+  case 119: /* nocase_stmt: CATCH $@15 compound_stmt $@16 opt_caught_stmt  */
+#line 625 "parser.y"
+                {
+		  Compile::endCond();
+		  (yyval.node) = Compile::doneCatch((yyvsp[-2].node), (yyvsp[0].node), TRUE);
+		}
+#line 2619 "y.tab.c"
+    break;
+
+  case 120: /* $@17: %empty  */
+#line 630 "parser.y"
+                { Compile::startSwitch((yyvsp[-1].node), typechecking); }
+#line 2625 "y.tab.c"
+    break;
+
+  case 121: /* nocase_stmt: SWITCH '(' f_list_exp ')' $@17 compound_stmt  */
+#line 632 "parser.y"
+                { (yyval.node) = Compile::endSwitch((yyvsp[-3].node), (yyvsp[0].node)); }
+#line 2631 "y.tab.c"
+    break;
+
+  case 122: /* $@18: %empty  */
+#line 634 "parser.y"
+                { (yyvsp[0].node) = Compile::label((yyvsp[-1].node)); }
+#line 2637 "y.tab.c"
+    break;
+
+  case 123: /* nocase_stmt: ident ':' $@18 stmt  */
+#line 635 "parser.y"
+                { (yyval.node) = Compile::concat((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 2643 "y.tab.c"
+    break;
+
+  case 124: /* nocase_stmt: GOTO ident ';'  */
+#line 637 "parser.y"
+                {
+		  (yyval.node) = Compile::gotoStmt((yyvsp[-1].node));
+		}
+#line 2651 "y.tab.c"
+    break;
+
+  case 125: /* nocase_stmt: BREAK ';'  */
+#line 641 "parser.y"
+                {
+		  (yyval.node) = Compile::breakStmt();
+		}
+#line 2659 "y.tab.c"
+    break;
+
+  case 126: /* nocase_stmt: CONTINUE ';'  */
+#line 645 "parser.y"
+                {
+		  (yyval.node) = Compile::continueStmt();
+		}
+#line 2667 "y.tab.c"
+    break;
+
+  case 127: /* nocase_stmt: RETURN f_opt_list_exp ';'  */
+#line 649 "parser.y"
+                { (yyval.node) = Compile::returnStmt((yyvsp[-1].node), typechecking); }
+#line 2673 "y.tab.c"
+    break;
+
+  case 128: /* nocase_stmt: ';'  */
+#line 650 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 2679 "y.tab.c"
+    break;
+
+  case 129: /* $@19: %empty  */
+#line 654 "parser.y"
+                {
+		  nstatements = 0;
+		  Compile::startCompound();
+		}
+#line 2688 "y.tab.c"
+    break;
+
+  case 130: /* compound_stmt: '{' $@19 dcltr_or_stmt_list '}'  */
+#line 659 "parser.y"
+                {
+		  nstatements++;
+		  (yyval.node) = Compile::endCompound((yyvsp[-1].node));
+		}
+#line 2697 "y.tab.c"
+    break;
+
+  case 131: /* opt_caught_stmt: %empty  */
+#line 667 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 2703 "y.tab.c"
+    break;
+
+  case 132: /* opt_caught_stmt: ':' stmt  */
+#line 669 "parser.y"
+                { (yyval.node) = (yyvsp[0].node); }
+#line 2709 "y.tab.c"
+    break;
+
+  case 133: /* case_list: case  */
+#line 673 "parser.y"
+                {
+		  (yyval.node) = (yyvsp[0].node);
+		  if ((yyvsp[0].node) != (Node *) NULL) {
+		      (yyval.node)->r.right = (yyval.node);
+		  }
+		}
+#line 2720 "y.tab.c"
+    break;
+
+  case 134: /* case_list: case_list case  */
+#line 680 "parser.y"
+                {
+		  if ((yyvsp[0].node) != (Node *) NULL) {
+		      (yyval.node) = (yyvsp[0].node);
+		      if ((yyvsp[-1].node) != (Node *) NULL) {
+			  (yyval.node)->l.left = (yyvsp[-1].node);
+			  (yyval.node)->r.right = (yyvsp[-1].node)->r.right;
+		      } else {
+			  (yyval.node)->r.right = (yyval.node);
+		      }
+		  } else {
+		      (yyval.node) = (yyvsp[-1].node);
+		  }
+		}
+#line 2738 "y.tab.c"
+    break;
+
+  case 135: /* case: CASE exp ':'  */
+#line 697 "parser.y"
+                { (yyval.node) = Compile::caseLabel((yyvsp[-1].node), (Node *) NULL); }
+#line 2744 "y.tab.c"
+    break;
+
+  case 136: /* case: CASE exp DOT_DOT exp ':'  */
+#line 699 "parser.y"
+                { (yyval.node) = Compile::caseLabel((yyvsp[-3].node), (yyvsp[-1].node)); }
+#line 2750 "y.tab.c"
+    break;
+
+  case 137: /* case: DEFAULT ':'  */
+#line 701 "parser.y"
+                { (yyval.node) = Compile::defaultLabel(); }
+#line 2756 "y.tab.c"
+    break;
+
+  case 138: /* function_call: function_name  */
+#line 706 "parser.y"
+                { (yyval.node) = Compile::flookup((yyvsp[0].node), typechecking); }
+#line 2762 "y.tab.c"
+    break;
+
+  case 139: /* function_call: COLON_COLON function_name  */
+#line 708 "parser.y"
+                { (yyval.node) = Compile::iflookup((yyvsp[0].node), (Node *) NULL); }
+#line 2768 "y.tab.c"
+    break;
+
+  case 140: /* function_call: function_name COLON_COLON function_name  */
+#line 710 "parser.y"
+                { (yyval.node) = Compile::iflookup((yyvsp[0].node), (yyvsp[-2].node)); }
+#line 2774 "y.tab.c"
+    break;
+
+  case 141: /* primary_p1_exp: INT_CONST  */
+#line 715 "parser.y"
+                { (yyval.node) = Node::createInt((yyvsp[0].number)); }
+#line 2780 "y.tab.c"
+    break;
+
+  case 142: /* primary_p1_exp: FLOAT_CONST  */
+#line 717 "parser.y"
+                { (yyval.node) = Node::createFloat(&(yyvsp[0].real)); }
+#line 2786 "y.tab.c"
+    break;
+
+  case 143: /* primary_p1_exp: NIL  */
+#line 718 "parser.y"
+                { (yyval.node) = Node::createNil(); }
+#line 2792 "y.tab.c"
+    break;
+
+  case 145: /* primary_p1_exp: '(' '{' opt_arg_list_comma '}' ')'  */
+#line 721 "parser.y"
+                { (yyval.node) = Compile::aggregate((yyvsp[-2].node), T_ARRAY); }
+#line 2798 "y.tab.c"
+    break;
+
+  case 146: /* primary_p1_exp: '(' '[' opt_assoc_arg_list_comma ']' ')'  */
+#line 723 "parser.y"
+                { (yyval.node) = Compile::aggregate((yyvsp[-2].node), T_MAPPING); }
+#line 2804 "y.tab.c"
+    break;
+
+  case 147: /* primary_p1_exp: ident  */
+#line 724 "parser.y"
+                {
+		  (yyval.node) = Compile::localVar((yyvsp[0].node));
+		  if ((yyval.node) == (Node *) NULL) {
+		      (yyval.node) = Compile::globalVar((yyvsp[0].node));
+		      if (typechecking) {
+			  if ((yyval.node)->mod != T_MIXED && !Config::typechecking()) {
+			      /*
+			       * global vars might be modified by untypechecked
+			       * functions...
+			       */
+			      (yyval.node) = Node::createMon(N_CAST, (yyval.node)->mod, (yyval.node));
+			      (yyval.node)->sclass = (yyval.node)->l.left->sclass;
+			      if ((yyval.node)->sclass != (String *) NULL) {
+				  (yyval.node)->sclass->ref();
+			      }
+			  }
+		      }
+		  }
+		  if (!typechecking) {
+		      /* the variable could be anything */
+		      (yyval.node)->mod = T_MIXED;
+		  }
+		}
+#line 2832 "y.tab.c"
+    break;
+
+  case 148: /* primary_p1_exp: COLON_COLON ident  */
+#line 747 "parser.y"
+                            {
+		  (yyval.node) = Compile::globalVar((yyvsp[0].node));
+		  if (typechecking) {
+		      if ((yyval.node)->mod != T_MIXED && !Config::typechecking()) {
+			  /*
+			   * global vars might be modified by untypechecked
+			   * functions...
+			   */
+			  (yyval.node) = Node::createMon(N_CAST, (yyval.node)->mod, (yyval.node));
+			  (yyval.node)->sclass = (yyval.node)->l.left->sclass;
+			  if ((yyval.node)->sclass != (String *) NULL) {
+			      (yyval.node)->sclass->ref();
+			  }
+		      }
+		  } else {
+		      /* the variable could be anything */
+		      (yyval.node)->mod = T_MIXED;
+		  }
+		}
+#line 2856 "y.tab.c"
+    break;
+
+  case 149: /* primary_p1_exp: '(' list_exp ')'  */
+#line 767 "parser.y"
+                { (yyval.node) = (yyvsp[-1].node); }
+#line 2862 "y.tab.c"
+    break;
+
+  case 150: /* primary_p1_exp: function_call '(' opt_arg_list ')'  */
+#line 769 "parser.y"
+                { (yyval.node) = Compile::checkcall(Compile::funcall((yyvsp[-3].node), (yyvsp[-1].node)),
+					  typechecking); }
+#line 2869 "y.tab.c"
+    break;
+
+  case 151: /* primary_p1_exp: '&' ident '(' opt_arg_list ')'  */
+#line 772 "parser.y"
+                { (yyval.node) = Compile::address((yyvsp[-3].node), (yyvsp[-1].node), typechecking); }
+#line 2875 "y.tab.c"
+    break;
+
+  case 152: /* primary_p1_exp: '&' '(' '*' cast_exp ')' '(' opt_arg_list ')'  */
+#line 774 "parser.y"
+                { (yyval.node) = Compile::extend((yyvsp[-4].node), (yyvsp[-1].node), typechecking); }
+#line 2881 "y.tab.c"
+    break;
+
+  case 153: /* primary_p1_exp: '(' '*' cast_exp ')' '(' opt_arg_list ')'  */
+#line 776 "parser.y"
+                { (yyval.node) = Compile::call((yyvsp[-4].node), (yyvsp[-1].node), typechecking); }
+#line 2887 "y.tab.c"
+    break;
+
+  case 154: /* $@20: %empty  */
+#line 778 "parser.y"
+                { Compile::startCond(); }
+#line 2893 "y.tab.c"
+    break;
+
+  case 155: /* primary_p1_exp: CATCH '(' $@20 list_exp ')'  */
+#line 780 "parser.y"
+                {
+		  Compile::endCond();
+		  (yyval.node) = Node::createMon(N_CATCH, T_STRING, (yyvsp[-1].node));
+		}
+#line 2902 "y.tab.c"
+    break;
+
+  case 156: /* primary_p1_exp: NEW opt_object string_exp  */
+#line 785 "parser.y"
+                { (yyval.node) = Compile::newObject((yyvsp[0].node), (Node *) NULL); }
+#line 2908 "y.tab.c"
+    break;
+
+  case 157: /* primary_p1_exp: NEW opt_object string_exp '(' opt_arg_list ')'  */
+#line 787 "parser.y"
+                { (yyval.node) = Compile::newObject((yyvsp[-3].node), (yyvsp[-1].node)); }
+#line 2914 "y.tab.c"
+    break;
+
+  case 158: /* primary_p1_exp: primary_p2_exp RARROW ident '(' opt_arg_list ')'  */
+#line 789 "parser.y"
+                {
+		  YYParser::_void((yyvsp[-5].node));
+		  (yyval.node) = Compile::checkcall(Compile::arrow((yyvsp[-5].node), (yyvsp[-3].node), (yyvsp[-1].node)),
+					  typechecking);
+		}
+#line 2924 "y.tab.c"
+    break;
+
+  case 159: /* primary_p1_exp: primary_p2_exp LARROW opt_object string_exp  */
+#line 795 "parser.y"
+                { (yyval.node) = Compile::instanceOf((yyvsp[-3].node), (yyvsp[0].node)); }
+#line 2930 "y.tab.c"
+    break;
+
+  case 161: /* primary_p2_exp: primary_p2_exp '[' f_list_exp ']'  */
+#line 801 "parser.y"
+                { (yyval.node) = YYParser::idx((yyvsp[-3].node), (yyvsp[-1].node)); }
+#line 2936 "y.tab.c"
+    break;
+
+  case 162: /* primary_p2_exp: primary_p2_exp '[' f_opt_list_exp DOT_DOT f_opt_list_exp ']'  */
+#line 803 "parser.y"
+                { (yyval.node) = YYParser::range((yyvsp[-5].node), (yyvsp[-3].node), (yyvsp[-1].node)); }
+#line 2942 "y.tab.c"
+    break;
+
+  case 164: /* postfix_exp: postfix_exp PLUS_PLUS  */
+#line 809 "parser.y"
+                { (yyval.node) = YYParser::postfix(N_PLUS_PLUS, (yyvsp[-1].node), "++"); }
+#line 2948 "y.tab.c"
+    break;
+
+  case 165: /* postfix_exp: postfix_exp MIN_MIN  */
+#line 811 "parser.y"
+                { (yyval.node) = YYParser::postfix(N_MIN_MIN, (yyvsp[-1].node), "--"); }
+#line 2954 "y.tab.c"
+    break;
+
+  case 167: /* prefix_exp: PLUS_PLUS cast_exp  */
+#line 817 "parser.y"
+                { (yyval.node) = YYParser::prefix(N_ADD_EQ_1, (yyvsp[0].node), "++"); }
+#line 2960 "y.tab.c"
+    break;
+
+  case 168: /* prefix_exp: MIN_MIN cast_exp  */
+#line 819 "parser.y"
+                { (yyval.node) = YYParser::prefix(N_SUB_EQ_1, (yyvsp[0].node), "--"); }
+#line 2966 "y.tab.c"
+    break;
+
+  case 169: /* prefix_exp: '-' cast_exp  */
+#line 821 "parser.y"
+                { (yyval.node) = YYParser::umin((yyvsp[0].node)); }
+#line 2972 "y.tab.c"
+    break;
+
+  case 170: /* prefix_exp: '+' cast_exp  */
+#line 823 "parser.y"
+                { (yyval.node) = (yyvsp[0].node); }
+#line 2978 "y.tab.c"
+    break;
+
+  case 171: /* prefix_exp: '!' cast_exp  */
+#line 825 "parser.y"
+                {
+		  YYParser::_void((yyvsp[0].node));
+		  (yyval.node) = Compile::_not((yyvsp[0].node));
+		}
+#line 2987 "y.tab.c"
+    break;
+
+  case 172: /* prefix_exp: '~' cast_exp  */
+#line 830 "parser.y"
+                {
+		  (yyval.node) = (yyvsp[0].node);
+		  YYParser::_void((yyval.node));
+		  if ((yyval.node)->mod == T_INT) {
+		      (yyval.node) = YYParser::_xor(N_XOR, (yyval.node), Node::createInt(-1), "^");
+		  } else if ((yyval.node)->mod == T_OBJECT || (yyval.node)->mod == T_CLASS) {
+		      (yyval.node) = Node::createMon(N_NEG, T_OBJECT, (yyval.node));
+		  } else {
+		      if (typechecking && (yyval.node)->mod != T_MIXED) {
+			  char tnbuf[TNBUFSIZE];
+
+			  Compile::error("bad argument type for ~ (%s)",
+					 Value::typeName(tnbuf, (yyval.node)->mod));
+		      }
+		      (yyval.node) = Node::createMon(N_NEG, T_MIXED, (yyval.node));
+		  }
+		}
+#line 3009 "y.tab.c"
+    break;
+
+  case 174: /* cast_exp: '(' type_specifier star_list ')' cast_exp  */
+#line 852 "parser.y"
+                {
+		  (yyvsp[-3].node)->mod |= ((yyvsp[-2].type) << REFSHIFT) & T_REF;
+		  (yyval.node) = YYParser::cast((yyvsp[0].node), (yyvsp[-3].node));
+		}
+#line 3018 "y.tab.c"
+    break;
+
+  case 176: /* mult_oper_exp: mult_oper_exp '*' cast_exp  */
+#line 861 "parser.y"
+                { (yyval.node) = YYParser::mult(N_MULT, (yyvsp[-2].node), (yyvsp[0].node), "*"); }
+#line 3024 "y.tab.c"
+    break;
+
+  case 177: /* mult_oper_exp: mult_oper_exp '/' cast_exp  */
+#line 863 "parser.y"
+                { (yyval.node) = YYParser::mdiv(N_DIV, (yyvsp[-2].node), (yyvsp[0].node), "/"); }
+#line 3030 "y.tab.c"
+    break;
+
+  case 178: /* mult_oper_exp: mult_oper_exp '%' cast_exp  */
+#line 865 "parser.y"
+                { (yyval.node) = YYParser::mod(N_MOD, (yyvsp[-2].node), (yyvsp[0].node), "%"); }
+#line 3036 "y.tab.c"
+    break;
+
+  case 180: /* add_oper_exp: add_oper_exp '+' mult_oper_exp  */
+#line 871 "parser.y"
+                { (yyval.node) = YYParser::add(N_ADD, (yyvsp[-2].node), (yyvsp[0].node), "+"); }
+#line 3042 "y.tab.c"
+    break;
+
+  case 181: /* add_oper_exp: add_oper_exp '-' mult_oper_exp  */
+#line 873 "parser.y"
+                { (yyval.node) = YYParser::sub(N_SUB, (yyvsp[-2].node), (yyvsp[0].node), "-"); }
+#line 3048 "y.tab.c"
+    break;
+
+  case 183: /* shift_oper_exp: shift_oper_exp LSHIFT add_oper_exp  */
+#line 879 "parser.y"
+                { (yyval.node) = YYParser::lshift(N_LSHIFT, (yyvsp[-2].node), (yyvsp[0].node), "<<"); }
+#line 3054 "y.tab.c"
+    break;
+
+  case 184: /* shift_oper_exp: shift_oper_exp RSHIFT add_oper_exp  */
+#line 881 "parser.y"
+                { (yyval.node) = YYParser::rshift(N_RSHIFT, (yyvsp[-2].node), (yyvsp[0].node), ">>"); }
+#line 3060 "y.tab.c"
+    break;
+
+  case 186: /* rel_oper_exp: rel_oper_exp '<' shift_oper_exp  */
+#line 887 "parser.y"
+                { (yyval.node) = YYParser::rel(N_LT, (yyval.node), (yyvsp[0].node), "<"); }
+#line 3066 "y.tab.c"
+    break;
+
+  case 187: /* rel_oper_exp: rel_oper_exp '>' shift_oper_exp  */
+#line 889 "parser.y"
+                { (yyval.node) = YYParser::rel(N_GT, (yyval.node), (yyvsp[0].node), ">"); }
+#line 3072 "y.tab.c"
+    break;
+
+  case 188: /* rel_oper_exp: rel_oper_exp LE shift_oper_exp  */
+#line 891 "parser.y"
+                { (yyval.node) = YYParser::rel(N_LE, (yyval.node), (yyvsp[0].node), "<="); }
+#line 3078 "y.tab.c"
+    break;
+
+  case 189: /* rel_oper_exp: rel_oper_exp GE shift_oper_exp  */
+#line 893 "parser.y"
+                { (yyval.node) = YYParser::rel(N_GE, (yyval.node), (yyvsp[0].node), ">="); }
+#line 3084 "y.tab.c"
+    break;
+
+  case 191: /* equ_oper_exp: equ_oper_exp EQ rel_oper_exp  */
+#line 899 "parser.y"
+                { (yyval.node) = YYParser::eq((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 3090 "y.tab.c"
+    break;
+
+  case 192: /* equ_oper_exp: equ_oper_exp NE rel_oper_exp  */
+#line 901 "parser.y"
+                { (yyval.node) = Compile::_not(YYParser::eq((yyvsp[-2].node), (yyvsp[0].node))); }
+#line 3096 "y.tab.c"
+    break;
+
+  case 194: /* bitand_oper_exp: bitand_oper_exp '&' equ_oper_exp  */
+#line 907 "parser.y"
+                { (yyval.node) = YYParser::_and(N_AND, (yyvsp[-2].node), (yyvsp[0].node), "&"); }
+#line 3102 "y.tab.c"
+    break;
+
+  case 196: /* bitxor_oper_exp: bitxor_oper_exp '^' bitand_oper_exp  */
+#line 913 "parser.y"
+                { (yyval.node) = YYParser::_xor(N_XOR, (yyvsp[-2].node), (yyvsp[0].node), "^"); }
+#line 3108 "y.tab.c"
+    break;
+
+  case 198: /* bitor_oper_exp: bitor_oper_exp '|' bitxor_oper_exp  */
+#line 919 "parser.y"
+                { (yyval.node) = YYParser::_or(N_OR, (yyvsp[-2].node), (yyvsp[0].node), "|"); }
+#line 3114 "y.tab.c"
+    break;
+
+  case 200: /* $@21: %empty  */
+#line 925 "parser.y"
+                { Compile::startCond(); }
+#line 3120 "y.tab.c"
+    break;
+
+  case 201: /* and_oper_exp: and_oper_exp LAND $@21 bitor_oper_exp  */
+#line 927 "parser.y"
+                {
+		  Compile::endCond();
+		  (yyval.node) = YYParser::land((yyvsp[-3].node), (yyvsp[0].node));
+		}
+#line 3129 "y.tab.c"
+    break;
+
+  case 203: /* $@22: %empty  */
+#line 936 "parser.y"
+                { Compile::startCond(); }
+#line 3135 "y.tab.c"
+    break;
+
+  case 204: /* or_oper_exp: or_oper_exp LOR $@22 and_oper_exp  */
+#line 938 "parser.y"
+                {
+		  Compile::endCond();
+		  (yyval.node) = YYParser::lor((yyvsp[-3].node), (yyvsp[0].node));
+		}
+#line 3144 "y.tab.c"
+    break;
+
+  case 206: /* $@23: %empty  */
+#line 947 "parser.y"
+                { Compile::startCond(); }
+#line 3150 "y.tab.c"
+    break;
+
+  case 207: /* $@24: %empty  */
+#line 949 "parser.y"
+                { Compile::startCond2(); }
+#line 3156 "y.tab.c"
+    break;
+
+  case 208: /* cond_exp: or_oper_exp '?' $@23 list_exp ':' $@24 cond_exp  */
+#line 951 "parser.y"
+                {
+		  Compile::matchCond();
+		  Compile::saveCond();
+		  (yyval.node) = YYParser::quest((yyvsp[-6].node), (yyvsp[-3].node), (yyvsp[0].node));
+		}
+#line 3166 "y.tab.c"
+    break;
+
+  case 210: /* exp: cond_exp '=' exp  */
+#line 961 "parser.y"
+                { (yyval.node) = YYParser::assign(Compile::assign((yyvsp[-2].node)), (yyvsp[0].node)); }
+#line 3172 "y.tab.c"
+    break;
+
+  case 211: /* exp: cond_exp PLUS_EQ exp  */
+#line 963 "parser.y"
+                {
+		  (yyval.node) = YYParser::add(N_ADD_EQ, Compile::lvalue((yyvsp[-2].node), "+="), (yyvsp[0].node),
+				     "+=");
+		}
+#line 3181 "y.tab.c"
+    break;
+
+  case 212: /* exp: cond_exp MIN_EQ exp  */
+#line 968 "parser.y"
+                {
+		  (yyval.node) = YYParser::sub(N_SUB_EQ, Compile::lvalue((yyvsp[-2].node), "-="), (yyvsp[0].node),
+				     "-=");
+		}
+#line 3190 "y.tab.c"
+    break;
+
+  case 213: /* exp: cond_exp MULT_EQ exp  */
+#line 973 "parser.y"
+                {
+		  (yyval.node) = YYParser::mult(N_MULT_EQ, Compile::lvalue((yyvsp[-2].node), "*="), (yyvsp[0].node),
+				      "*=");
+		}
+#line 3199 "y.tab.c"
+    break;
+
+  case 214: /* exp: cond_exp DIV_EQ exp  */
+#line 978 "parser.y"
+                {
+		  (yyval.node) = YYParser::mdiv(N_DIV_EQ, Compile::lvalue((yyvsp[-2].node), "/="), (yyvsp[0].node),
+				      "/=");
+		}
+#line 3208 "y.tab.c"
+    break;
+
+  case 215: /* exp: cond_exp MOD_EQ exp  */
+#line 983 "parser.y"
+                {
+		  (yyval.node) = YYParser::mod(N_MOD_EQ, Compile::lvalue((yyvsp[-2].node), "%="), (yyvsp[0].node),
+				     "%=");
+		}
+#line 3217 "y.tab.c"
+    break;
+
+  case 216: /* exp: cond_exp LSHIFT_EQ exp  */
+#line 988 "parser.y"
+                {
+		  (yyval.node) = YYParser::lshift(N_LSHIFT_EQ, Compile::lvalue((yyvsp[-2].node), "<<="),
+					(yyvsp[0].node), "<<=");
+		}
+#line 3226 "y.tab.c"
+    break;
+
+  case 217: /* exp: cond_exp RSHIFT_EQ exp  */
+#line 993 "parser.y"
+                {
+		  (yyval.node) = YYParser::rshift(N_RSHIFT_EQ, Compile::lvalue((yyvsp[-2].node), ">>="),
+					(yyvsp[0].node), ">>=");
+		}
+#line 3235 "y.tab.c"
+    break;
+
+  case 218: /* exp: cond_exp AND_EQ exp  */
+#line 998 "parser.y"
+                {
+		  (yyval.node) = YYParser::_and(N_AND_EQ, Compile::lvalue((yyvsp[-2].node), "&="), (yyvsp[0].node),
+				      "&=");
+		}
+#line 3244 "y.tab.c"
+    break;
+
+  case 219: /* exp: cond_exp XOR_EQ exp  */
+#line 1003 "parser.y"
+                {
+		  (yyval.node) = YYParser::_xor(N_XOR_EQ, Compile::lvalue((yyvsp[-2].node), "^="), (yyvsp[0].node),
+				      "^=");
+		}
+#line 3253 "y.tab.c"
+    break;
+
+  case 220: /* exp: cond_exp OR_EQ exp  */
+#line 1008 "parser.y"
+                {
+		  (yyval.node) = YYParser::_or(N_OR_EQ, Compile::lvalue((yyvsp[-2].node), "|="), (yyvsp[0].node),
+				     "|=");
+		}
+#line 3262 "y.tab.c"
+    break;
+
+  case 222: /* list_exp: list_exp ',' exp  */
+#line 1017 "parser.y"
+                { (yyval.node) = YYParser::comma((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 3268 "y.tab.c"
+    break;
+
+  case 223: /* opt_list_exp: %empty  */
+#line 1022 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 3274 "y.tab.c"
+    break;
+
+  case 225: /* f_list_exp: list_exp  */
+#line 1028 "parser.y"
+                { YYParser::_void((yyval.node) = (yyvsp[0].node)); }
+#line 3280 "y.tab.c"
+    break;
+
+  case 226: /* f_opt_list_exp: opt_list_exp  */
+#line 1033 "parser.y"
+                { YYParser::_void((yyval.node) = (yyvsp[0].node)); }
+#line 3286 "y.tab.c"
+    break;
+
+  case 227: /* arg_list: exp  */
+#line 1037 "parser.y"
+                { YYParser::_void((yyval.node) = (yyvsp[0].node)); }
+#line 3292 "y.tab.c"
+    break;
+
+  case 228: /* arg_list: arg_list ',' exp  */
+#line 1039 "parser.y"
+                {
+		  YYParser::_void((yyvsp[0].node));
+		  (yyval.node) = Node::createBin(N_PAIR, 0, (yyvsp[-2].node), (yyvsp[0].node));
+		}
+#line 3301 "y.tab.c"
+    break;
+
+  case 229: /* opt_arg_list: %empty  */
+#line 1047 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 3307 "y.tab.c"
+    break;
+
+  case 231: /* opt_arg_list: arg_list ELLIPSIS  */
+#line 1050 "parser.y"
+                {
+		  (yyval.node) = (yyvsp[-1].node);
+		  if ((yyval.node)->type == N_PAIR) {
+		      (yyval.node)->r.right = Node::createMon(N_SPREAD, -1, (yyval.node)->r.right);
+		  } else {
+		      (yyval.node) = Node::createMon(N_SPREAD, -1, (yyval.node));
+		  }
+		}
+#line 3320 "y.tab.c"
+    break;
+
+  case 232: /* opt_arg_list_comma: %empty  */
+#line 1062 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 3326 "y.tab.c"
+    break;
+
+  case 234: /* opt_arg_list_comma: arg_list ','  */
+#line 1065 "parser.y"
+                { (yyval.node) = (yyvsp[-1].node); }
+#line 3332 "y.tab.c"
+    break;
+
+  case 235: /* assoc_exp: exp ':' exp  */
+#line 1070 "parser.y"
+                {
+		  YYParser::_void((yyvsp[-2].node));
+		  YYParser::_void((yyvsp[0].node));
+		  (yyval.node) = Node::createBin(N_COMMA, 0, (yyvsp[-2].node), (yyvsp[0].node));
+		}
+#line 3342 "y.tab.c"
+    break;
+
+  case 237: /* assoc_arg_list: assoc_arg_list ',' assoc_exp  */
+#line 1080 "parser.y"
+                { (yyval.node) = Node::createBin(N_PAIR, 0, (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 3348 "y.tab.c"
+    break;
+
+  case 238: /* opt_assoc_arg_list_comma: %empty  */
+#line 1085 "parser.y"
+                { (yyval.node) = (Node *) NULL; }
+#line 3354 "y.tab.c"
+    break;
+
+  case 240: /* opt_assoc_arg_list_comma: assoc_arg_list ','  */
+#line 1088 "parser.y"
+                { (yyval.node) = (yyvsp[-1].node); }
+#line 3360 "y.tab.c"
+    break;
+
+
+#line 3364 "y.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 1091 "parser.y"
+
+
+/*
+ * if the argument is of type void, an error will result
+ */
+void YYParser::_void(Node *n)
+{
+    if (n != (Node *) NULL && n->mod == T_VOID) {
+	Compile::error("void value not ignored");
+	n->mod = T_MIXED;
+    }
+}
+
+/*
+ * typecheck the argument of a unary operator
+ */
+bool YYParser::unary(Node *n, const char *name)
+{
+    char tnbuf[TNBUFSIZE];
+
+    _void(n);
+    if (typechecking && !T_ARITHMETIC(n->mod) && n->mod != T_MIXED) {
+	Compile::error("bad argument type for %s (%s)", name,
+		       Value::typeName(tnbuf, n->mod));
+	n->mod = T_MIXED;
+	return FALSE;
+    }
+    return TRUE;
+}
+
+/*
+ * handle a postfix assignment operator
+ */
+Node *YYParser::postfix(int op, Node *n, const char *name)
+{
+    unary(n, name);
+    return Node::createMon((n->mod == T_INT) ? op + 1 : op, n->mod,
+			   Compile::lvalue(n, name));
+}
+
+/*
+ * handle a prefix assignment operator
+ */
+Node *YYParser::prefix(int op, Node *n, const char *name)
+{
+    unsigned short type;
+
+    if (n->mod == T_OBJECT || n->mod == T_CLASS) {
+	type = T_OBJECT;
+    } else {
+	unary(n, name);
+	type = n->mod;
+    }
+    return Node::createMon((type == T_INT) ? op + 1 : op, type,
+			   Compile::lvalue(n, name));
+}
+
+/*
+ * cast an expression to a type
+ */
+Node *YYParser::cast(Node *n, Node *type)
+{
+    Float flt;
+    LPCint i;
+    char *p, buffer[FLOAT_BUFFER];
+
+    if (type->mod != n->mod) {
+	switch (type->mod) {
+	case T_INT:
+	    switch (n->type) {
+	    case N_FLOAT:
+		/* cast float constant to int */
+		NFLT_GET(n, flt);
+		return Node::createInt(flt.ftoi());
+
+	    case N_STR:
+		/* cast string to int */
+		p = n->l.string->text;
+		i = strtoint(&p);
+		if (p == n->l.string->text + n->l.string->len) {
+		    return Node::createInt(i);
+		} else {
+		    Compile::error("cast of invalid string constant");
+		    n->mod = T_MIXED;
+		}
+		break;
+
+	    case N_TOFLOAT:
+	    case N_TOSTRING:
+		if (n->l.left->type == N_INT) {
+		    /* (int) (float) i, (int) (string) i */
+		    return n->l.left;
+		}
+		/* fall through */
+	    default:
+		if (n->mod == T_FLOAT || n->mod == T_STRING ||
+		    n->mod == T_MIXED) {
+		    return Node::createMon(N_TOINT, T_INT, n);
+		}
+		break;
+	    }
+	    break;
+
+	case T_FLOAT:
+	    switch (n->type) {
+	    case N_INT:
+		/* cast int constant to float */
+		Float::itof(n->l.number, &flt);
+		return Node::createFloat(&flt);
+
+	    case N_STR:
+		/* cast string to float */
+		p = n->l.string->text;
+		if (Float::atof(&p, &flt) &&
+		    p == n->l.string->text + n->l.string->len) {
+		    return Node::createFloat(&flt);
+		} else {
+		    yyerror("cast of invalid string constant");
+		    n->mod = T_MIXED;
+		}
+		break;
+
+	    case N_TOSTRING:
+		if (n->l.left->mod == T_INT) {
+		    return Node::createMon(N_TOFLOAT, T_FLOAT, n->l.left);
+		}
+		/* fall through */
+	    default:
+		if (n->mod == T_INT || n->mod == T_STRING || n->mod == T_MIXED)
+		{
+		    return Node::createMon(N_TOFLOAT, T_FLOAT, n);
+		}
+		break;
+	    }
+	    break;
+
+	case T_STRING:
+	    switch (n->type) {
+	    case N_INT:
+		/* cast int constant to string */
+		snprintf(buffer, sizeof(buffer), "%ld", (long) n->l.number);
+		return Node::createStr(String::create(buffer, strlen(buffer)));
+
+	    case N_FLOAT:
+		/* cast float constant to string */
+		NFLT_GET(n, flt);
+		flt.ftoa(buffer);
+		return Node::createStr(String::create(buffer, strlen(buffer)));
+
+	    default:
+		if (n->mod == T_INT || n->mod == T_FLOAT || n->mod == T_MIXED) {
+		    return Node::createMon(N_TOSTRING, T_STRING, n);
+		}
+		break;
+	    }
+	    break;
+	}
+
+	if (type->mod == T_MIXED || (type->mod & T_TYPE) == T_VOID) {
+	    /* (mixed), (void), (void *) */
+	    Compile::error("cannot cast to %s",
+			   Value::typeName(buffer, type->mod));
+	    n->mod = T_MIXED;
+	} else if ((type->mod & T_REF) < (n->mod & T_REF)) {
+	    /* (mixed *) of (mixed **) */
+	    Compile::error("illegal cast of array type (%s)",
+			   Value::typeName(buffer, n->mod));
+	} else if ((n->mod & T_TYPE) != T_MIXED &&
+		   ((type->mod & T_TYPE) != T_CLASS ||
+		    ((n->mod & T_TYPE) != T_OBJECT &&
+		     (n->mod & T_TYPE) != T_CLASS) ||
+		    (type->mod & T_REF) != (n->mod & T_REF))) {
+	    /* can only cast from mixed, or object/class to class */
+	    Compile::error("cast of invalid type (%s)",
+			   Value::typeName(buffer, n->mod));
+	} else {
+	    if ((type->mod & T_REF) == 0 || (n->mod & T_REF) == 0) {
+		/* runtime cast */
+		n = Node::createMon(N_CAST, type->mod, n);
+	    } else {
+		n->mod = type->mod;
+	    }
+	    n->sclass = type->sclass;
+	    if (n->sclass != (String *) NULL) {
+		n->sclass->ref();
+	    }
+	}
+    } else if (type->mod == T_CLASS && type->sclass->cmp(n->sclass) != 0) {
+	/*
+	 * cast to different object class
+	 */
+	n = Node::createMon(N_CAST, type->mod, n);
+	n->sclass = type->sclass;
+	if (n->sclass != (String *) NULL) {
+	    n->sclass->ref();
+	}
+    }
+    return n;
+}
+
+/*
+ * handle the [ ] operator
+ */
+Node *YYParser::idx(Node *n1, Node *n2)
+{
+    char tnbuf[TNBUFSIZE];
+    unsigned short type;
+
+    if (n1->type == N_STR && n2->type == N_INT) {
+	/* str [ int ] */
+	if (n2->l.number < 0 || n2->l.number >= (LPCint) n1->l.string->len) {
+	    Compile::error("string index out of range");
+	} else {
+	    n2->l.number =
+		UCHAR(n1->l.string->text[n1->l.string->index(n2->l.number)]);
+	}
+	return n2;
+    }
+
+    if ((n1->mod & T_REF) != 0) {
+	/*
+	 * array
+	 */
+	if (typechecking) {
+	    type = n1->mod - (1 << REFSHIFT);
+	    if (n2->mod != T_INT && n2->mod != T_MIXED) {
+		Compile::error("bad index type (%s)",
+			       Value::typeName(tnbuf, n2->mod));
+	    }
+	    if (type != T_MIXED &&
+		(n1->type != N_FUNC ||
+		 n1->r.number != (((LPCint) KFCALL << 24) | KF_CALL_TRACE))) {
+		/* you can't trust these arrays */
+		n2 = Node::createMon(N_CAST, type,
+				     Node::createBin(N_INDEX, type, n1, n2));
+		n2->sclass = n1->sclass;
+		if (n2->sclass != (String *) NULL) {
+		    n2->sclass->ref();
+		}
+		return n2;
+	    }
+	}
+	type = T_MIXED;
+    } else if (n1->mod == T_STRING) {
+	/*
+	 * string
+	 */
+	if (typechecking && n2->mod != T_INT && n2->mod != T_MIXED) {
+	    Compile::error("bad index type (%s)",
+			   Value::typeName(tnbuf, n2->mod));
+	}
+	type = T_INT;
+    } else {
+	if (typechecking && n1->mod != T_OBJECT && n1->mod != T_CLASS &&
+	    n1->mod != T_MAPPING && n1->mod != T_MIXED) {
+	    Compile::error("bad indexed type (%s)",
+			   Value::typeName(tnbuf, n1->mod));
+	}
+	type = T_MIXED;
+    }
+    return Node::createBin(N_INDEX, type, n1, n2);
+}
+
+/*
+ * handle the [ .. ] operator
+ */
+Node *YYParser::range(Node *n1, Node *n2, Node *n3)
+{
+    unsigned short type;
+
+    if (n1->type == N_STR && (n2 == (Node *) NULL || n2->type == N_INT) &&
+	(n3 == (Node *) NULL || n3->type == N_INT)) {
+	LPCint from, to;
+
+	/* str [ int .. int ] */
+	from = (n2 == (Node *) NULL) ? 0 : n2->l.number;
+	to = (n3 == (Node *) NULL) ? n1->l.string->len - 1 : n3->l.number;
+	if (from < 0 || from > to + 1 || to >= (LPCint) n1->l.string->len) {
+	    Compile::error("invalid string range");
+	} else {
+	    return Node::createStr(n1->l.string->range(from, to));
+	}
+    }
+
+    type = T_MIXED;
+    if (n1->mod == T_OBJECT || n1->mod == T_CLASS) {
+	type = T_OBJECT;
+    } else if (n1->mod == T_MAPPING) {
+	type = T_MAPPING;
+    } else if (typechecking && n1->mod != T_MIXED) {
+	char tnbuf[TNBUFSIZE];
+
+	/* indices */
+	if (n2 != (Node *) NULL && n2->mod != T_INT && n2->mod != T_MIXED) {
+	    Compile::error("bad index type (%s)",
+			   Value::typeName(tnbuf, n2->mod));
+	}
+	if (n3 != (Node *) NULL && n3->mod != T_INT && n3->mod != T_MIXED) {
+	    Compile::error("bad index type (%s)",
+			   Value::typeName(tnbuf, n3->mod));
+	}
+	/* range */
+	if ((n1->mod & T_REF) == 0 && n1->mod != T_STRING && n1->mod != T_MIXED)
+	{
+	    Compile::error("bad indexed type (%s)",
+			   Value::typeName(tnbuf, n1->mod));
+	}
+	type = n1->mod;
+    }
+
+    return Node::createBin(N_RANGE, type, n1,
+			   Node::createBin(N_PAIR, 0, n2, n3));
+}
+
+/*
+ * handle a binary int operator
+ */
+Node *YYParser::bini(int op, Node *n1, Node *n2, const char *name)
+{
+    char tnbuf1[TNBUFSIZE], tnbuf2[TNBUFSIZE];
+    unsigned short type;
+
+    _void(n1);
+    _void(n2);
+
+    type = T_MIXED;
+    if (n1->mod == T_OBJECT || n1->mod == T_CLASS) {
+	type = T_OBJECT;
+    } else if (n1->mod == T_INT && (n2->mod == T_INT || n2->mod == T_MIXED)) {
+	type = T_INT;
+    } else if (typechecking && n1->mod != T_MIXED) {
+	Compile::error("bad argument types for %s (%s, %s)", name,
+		       Value::typeName(tnbuf1, n1->mod),
+		       Value::typeName(tnbuf2, n2->mod));
+    }
+    if (n1->mod == T_INT && n2->mod == T_INT) {
+	op++;
+    }
+    return Node::createBin(op, type, n1, n2);
+}
+
+
+/*
+ * handle a binary arithmetic operator
+ */
+Node *YYParser::bina(int op, Node *n1, Node *n2, const char *name)
+{
+    char tnbuf1[TNBUFSIZE], tnbuf2[TNBUFSIZE];
+    unsigned short type;
+
+    _void(n1);
+    _void(n2);
+
+    type = T_MIXED;
+    if (n1->mod == T_OBJECT || n1->mod == T_CLASS) {
+	type = T_OBJECT;
+    } else if (n1->mod == T_INT && (n2->mod == T_INT || n2->mod == T_MIXED)) {
+	if (n1->mod == T_INT && n2->mod == T_INT) {
+	    op++;
+	}
+	type = T_INT;
+    } else if (n1->mod == T_FLOAT && (n2->mod == T_FLOAT || n2->mod == T_MIXED))
+    {
+	type = T_FLOAT;
+	if (n1->mod == T_FLOAT && n2->mod == T_FLOAT) {
+	    op += 2;
+	}
+    } else if (typechecking && n1->mod != T_MIXED) {
+	Compile::error("bad argument types for %s (%s, %s)", name,
+		       Value::typeName(tnbuf1, n1->mod),
+		       Value::typeName(tnbuf2, n2->mod));
+    }
+
+    return Node::createBin(op, type, n1, n2);
+}
+
+/*
+ * handle the * *= operators
+ */
+Node *YYParser::mult(int op, Node *n1, Node *n2, const char *name)
+{
+    Float f1, f2;
+
+    if (n1->type == N_INT && n2->type == N_INT) {
+	/* i * i */
+	n1->l.number *= n2->l.number;
+	return n1;
+    }
+    if (n1->type == N_FLOAT && n2->type == N_FLOAT) {
+	NFLT_GET(n1, f1);
+	NFLT_GET(n2, f2);
+	f1.mult(f2, Compile::pureFloat());
+	NFLT_PUT(n1, f1);
+	return n1;
+    }
+    return bina(op, n1, n2, name);
+}
+
+/*
+ * handle the / /= operators
+ */
+Node *YYParser::mdiv(int op, Node *n1, Node *n2, const char *name)
+{
+    Float f1, f2;
+
+    if (n1->type == N_INT && n2->type == N_INT) {
+	LPCint i, d;
+
+	/* i / i */
+	i = n1->l.number;
+	d = n2->l.number;
+	if (d == 0) {
+	    /* i / 0 */
+	    Compile::error("division by zero");
+	    return n1;
+	}
+	n1->l.number = i / d;
+	return n1;
+    } else if (n1->type == N_FLOAT && n2->type == N_FLOAT) {
+	/* f / f */
+	if (NFLT_ISZERO(n2) && !Compile::pureFloat()) {
+	    /* f / 0.0 */
+	    Compile::error("division by zero");
+	    return n1;
+	}
+	NFLT_GET(n1, f1);
+	NFLT_GET(n2, f2);
+	f1.div(f2, Compile::pureFloat());
+	NFLT_PUT(n1, f1);
+	return n1;
+    }
+
+    return bina(op, n1, n2, name);
+}
+
+/*
+ * handle the % %= operators
+ */
+Node *YYParser::mod(int op, Node *n1, Node *n2, const char *name)
+{
+    if (n1->type == N_INT && n2->type == N_INT) {
+	LPCint i, d;
+
+	/* i % i */
+	i = n1->l.number;
+	d = n2->l.number;
+	if (d == 0) {
+	    /* i % 0 */
+	    Compile::error("modulus by zero");
+	    return n1;
+	}
+	n1->l.number = i % d;
+	return n1;
+    }
+
+    return bini(op, n1, n2, name);
+}
+
+/*
+ * handle the + += operators, possibly rearranging the order
+ * of the expression
+ */
+Node *YYParser::add(int op, Node *n1, Node *n2, const char *name)
+{
+    char tnbuf1[TNBUFSIZE], tnbuf2[TNBUFSIZE];
+    Float f1, f2;
+    unsigned short type;
+
+    _void(n1);
+    _void(n2);
+
+    if (n1->mod == T_STRING) {
+	if (n2->mod == T_INT || n2->mod == T_FLOAT ||
+	    (n2->mod == T_MIXED && typechecking)) {
+	    n2 = cast(n2, Node::createType(T_STRING, (String *) NULL));
+	}
+    } else if (n2->mod == T_STRING && op == N_ADD) {
+	if (n1->mod == T_INT || n1->mod == T_FLOAT) {
+	    n1 = cast(n1, Node::createType(T_STRING, (String *) NULL));
+	}
+    }
+
+    if (n1->type == N_INT && n2->type == N_INT) {
+	/* i + i */
+	n1->l.number += n2->l.number;
+	return n1;
+    }
+    if (n1->type == N_FLOAT && n2->type == N_FLOAT) {
+	/* f + f */
+	NFLT_GET(n1, f1);
+	NFLT_GET(n2, f2);
+	f1.add(f2, Compile::pureFloat());
+	NFLT_PUT(n1, f1);
+	return n1;
+    }
+    if (n1->type == N_STR && n2->type == N_STR) {
+	/* s + s */
+	return Node::createStr(n1->l.string->add(n2->l.string));
+    }
+
+    if (n1->mod == T_OBJECT || n1->mod == T_CLASS) {
+	type = T_OBJECT;
+    } else if ((type=Compile::matchType(n1->mod, n2->mod)) == T_NIL) {
+	type = T_MIXED;
+	if (typechecking) {
+	    Compile::error("bad argument types for %s (%s, %s)", name,
+			   Value::typeName(tnbuf1, n1->mod),
+			   Value::typeName(tnbuf2, n2->mod));
+	}
+    } else if (type == T_INT) {
+	op++;
+    } else if (op == N_ADD_EQ && n1->mod != n2->mod) {
+	type = n1->mod;
+	if (n1->mod == T_INT) {
+	    n2 = Node::createMon(N_CAST, T_INT, n2);
+	    type = T_INT;
+	    op++;
+	} else if (n1->mod == T_FLOAT) {
+	    n2 = Node::createMon(N_CAST, T_FLOAT, n2);
+	    type = T_FLOAT;
+	}
+    }
+    return Node::createBin(op, type, n1, n2);
+}
+
+/*
+ * handle the - -= operators
+ */
+Node *YYParser::sub(int op, Node *n1, Node *n2, const char *name)
+{
+    char tnbuf1[TNBUFSIZE], tnbuf2[TNBUFSIZE];
+    Float f1, f2;
+    unsigned short type;
+
+    _void(n1);
+    _void(n2);
+
+    if (n1->type == N_INT && n2->type == N_INT) {
+	/* i - i */
+	n1->l.number -= n2->l.number;
+	return n1;
+    }
+    if (n1->type == N_FLOAT && n2->type == N_FLOAT) {
+	/* f - f */
+	NFLT_GET(n1, f1);
+	NFLT_GET(n2, f2);
+	f1.sub(f2, Compile::pureFloat());
+	NFLT_PUT(n1, f1);
+	return n1;
+    }
+
+    if (n1->mod == T_OBJECT || n1->mod == T_CLASS) {
+	type = T_OBJECT;
+    } else if ((type=Compile::matchType(n1->mod, n2->mod)) == T_NIL ||
+	       type == T_STRING || type == T_MAPPING) {
+	if ((type=n1->mod) != T_MAPPING ||
+	    (n2->mod != T_MIXED && (n2->mod & T_REF) == 0)) {
+	    type = T_MIXED;
+	    if (typechecking) {
+		Compile::error("bad argument types for %s (%s, %s)", name,
+			       Value::typeName(tnbuf1, n1->mod),
+			       Value::typeName(tnbuf2, n2->mod));
+	    }
+	}
+    } else if (type == T_INT) {
+	op++;
+    } else if (type == T_MIXED) {
+	type = n1->mod;
+    } else if (n1->mod == T_MIXED && (n2->mod & T_REF)) {
+	type = T_MIXED;
+    }
+    return Node::createBin(op, type, n1, n2);
+}
+
+/*
+ * handle unary minus
+ */
+Node *YYParser::umin(Node *n)
+{
+    Float flt;
+
+    if (n->mod == T_OBJECT || n->mod == T_CLASS) {
+	return Node::createMon(N_UMIN, T_OBJECT, n);
+    } else if (n->mod == T_MIXED) {
+	return Node::createMon(N_UMIN, T_MIXED, n);
+    } else if (unary(n, "unary -")) {
+	if (n->mod == T_FLOAT) {
+	    flt.initZero();
+	    n = sub(N_SUB, Node::createFloat(&flt), n, "-");
+	} else {
+	    n = sub(N_SUB, Node::createInt(0), n, "-");
+	}
+    }
+    return n;
+}
+
+/*
+ * handle the << <<= operators
+ */
+Node *YYParser::lshift(int op, Node *n1, Node *n2, const char *name)
+{
+    if (n2->type == N_INT) {
+	if (n2->l.number < 0) {
+	    Compile::error("negative left shift");
+	    n2->l.number = 0;
+	}
+	if (n1->type == N_INT) {
+	    /* i << i */
+	    n1->l.number = (n2->l.number < LPCINT_BITS) ?
+			    (LPCuint) n1->l.number << n2->l.number : 0;
+	    return n1;
+	}
+    }
+
+    return bini(op, n1, n2, name);
+}
+
+/*
+ * handle the >> >>= operators
+ */
+Node *YYParser::rshift(int op, Node *n1, Node *n2, const char *name)
+{
+    if (n2->type == N_INT) {
+	if (n2->l.number < 0) {
+	    Compile::error("negative right shift");
+	    n2->l.number = 0;
+	}
+	if (n1->type == N_INT) {
+	    /* i >> i */
+	    n1->l.number = (n2->l.number < LPCINT_BITS) ?
+			    (LPCuint) n1->l.number >> n2->l.number : 0;
+	    return n1;
+	}
+    }
+
+    return bini(op, n1, n2, name);
+}
+
+/*
+ * handle the < > <= >= operators
+ */
+Node *YYParser::rel(int op, Node *n1, Node *n2, const char *name)
+{
+    char tnbuf1[TNBUFSIZE], tnbuf2[TNBUFSIZE];
+
+    _void(n1);
+    _void(n2);
+
+    if (n1->type == N_INT && n2->type == N_INT) {
+	/* i . i */
+	switch (op) {
+	case N_GE:
+	    n1->l.number = (n1->l.number >= n2->l.number);
+	    break;
+
+	case N_GT:
+	    n1->l.number = (n1->l.number > n2->l.number);
+	    break;
+
+	case N_LE:
+	    n1->l.number = (n1->l.number <= n2->l.number);
+	    break;
+
+	case N_LT:
+	    n1->l.number = (n1->l.number < n2->l.number);
+	    break;
+	}
+	return n1;
+    }
+    if (n1->type == N_FLOAT && n2->type == N_FLOAT) {
+	Float f1, f2;
+
+	/* f . f */
+	NFLT_GET(n1, f1);
+	NFLT_GET(n2, f2);
+
+	switch (op) {
+	case N_GE:
+	    return Node::createInt((f1.cmp(f2) >= 0));
+
+	case N_GT:
+	    return Node::createInt((f1.cmp(f2) > 0));
+
+	case N_LE:
+	    return Node::createInt((f1.cmp(f2) <= 0));
+
+	case N_LT:
+	    return Node::createInt((f1.cmp(f2) < 0));
+	}
+	return n1;
+    }
+    if (n1->type == N_STR && n2->type == N_STR) {
+	/* s . s */
+	switch (op) {
+	case N_GE:
+	    return Node::createInt((n1->l.string->cmp(n2->l.string) >= 0));
+
+	case N_GT:
+	    return Node::createInt((n1->l.string->cmp(n2->l.string) > 0));
+
+	case N_LE:
+	    return Node::createInt((n1->l.string->cmp(n2->l.string) <= 0));
+
+	case N_LT:
+	    return Node::createInt((n1->l.string->cmp(n2->l.string) < 0));
+	}
+    }
+
+    if (n1->mod != T_OBJECT && n1->mod != T_CLASS && n1->mod != T_MIXED &&
+	typechecking &&
+	((n1->mod != n2->mod && n2->mod != T_MIXED) || !T_ARITHSTR(n1->mod) ||
+	 (!T_ARITHSTR(n2->mod) && n2->mod != T_MIXED))) {
+	Compile::error("bad argument types for %s (%s, %s)", name,
+		       Value::typeName(tnbuf1, n1->mod),
+		       Value::typeName(tnbuf2, n2->mod));
+    } else if (n1->mod == T_INT && n2->mod == T_INT) {
+	op++;
+    }
+    return Node::createBin(op, T_INT, n1, n2);
+}
+
+/*
+ * handle the == operator
+ */
+Node *YYParser::eq(Node *n1, Node *n2)
+{
+    char tnbuf1[TNBUFSIZE], tnbuf2[TNBUFSIZE];
+    Float f1, f2;
+    int op;
+
+    _void(n1);
+    _void(n2);
+
+    switch (n1->type) {
+    case N_INT:
+	if (n2->type == N_INT) {
+	    /* i == i */
+	    n1->l.number = (n1->l.number == n2->l.number);
+	    return n1;
+	}
+	if (nil_node == N_INT && n1->l.number == 0 && n2->type == N_STR) {
+	    /* nil == str */
+	    return Node::createInt(FALSE);
+	}
+	break;
+
+    case N_FLOAT:
+	if (n2->type == N_FLOAT) {
+	    /* f == f */
+	    NFLT_GET(n1, f1);
+	    NFLT_GET(n2, f2);
+	    return Node::createInt((f1.cmp(f2) == 0));
+	}
+	break;
+
+    case N_STR:
+	if (n2->type == N_STR) {
+	    /* s == s */
+	    return Node::createInt((n1->l.string->cmp(n2->l.string) == 0));
+	}
+	if (n2->type == nil_node && n2->l.number == 0) {
+	    /* s == nil */
+	    return Node::createInt(FALSE);
+	}
+	break;
+
+    case N_NIL:
+	if (n2->type == N_NIL) {
+	    /* nil == nil */
+	    return Node::createInt(TRUE);
+	}
+	if (n2->type == N_STR) {
+	    /* nil == str */
+	    return Node::createInt(FALSE);
+	}
+	break;
+    }
+
+    op = N_EQ;
+    if (Compile::matchType(n1->mod, n2->mod) == T_NIL &&
+	(!Compile::nil(n1) || !T_POINTER(n2->mod)) &&
+	(!Compile::nil(n2) || !T_POINTER(n1->mod))) {
+	if (typechecking) {
+	    Compile::error("incompatible types for equality (%s, %s)",
+			   Value::typeName(tnbuf1, n1->mod),
+			   Value::typeName(tnbuf2, n2->mod));
+	}
+    } else if (n1->mod == T_INT && n2->mod == T_INT) {
+	op++;
+    }
+    return Node::createBin(op, T_INT, n1, n2);
+}
+
+/*
+ * handle the & &= operators
+ */
+Node *YYParser::_and(int op, Node *n1, Node *n2, const char *name)
+{
+    unsigned short type;
+
+    if (n1->type == N_INT && n2->type == N_INT) {
+	/* i & i */
+	n1->l.number &= n2->l.number;
+	return n1;
+    }
+    if ((((type=n1->mod) == T_MIXED || type == T_MAPPING) &&
+	 ((n2->mod & T_REF) != 0 || n2->mod == T_MIXED)) ||
+	((type=Compile::matchType(n1->mod, n2->mod)) & T_REF) != 0) {
+	/*
+	 * possibly array & array or mapping & array
+	 */
+	return Node::createBin(op, type, n1, n2);
+    }
+    return bini(op, n1, n2, name);
+}
+
+/*
+ * handle the ^ ^= operators
+ */
+Node *YYParser::_xor(int op, Node *n1, Node *n2, const char *name)
+{
+    unsigned short type;
+
+    if (n1->type == N_INT && n2->type == N_INT) {
+	/* i ^ i */
+	n1->l.number ^= n2->l.number;
+	return n1;
+    }
+    if (((type=n1->mod) == T_MIXED && n2->mod == T_MIXED) ||
+	((type=Compile::matchType(n1->mod, n2->mod)) & T_REF) != 0) {
+	/*
+	 * possibly array ^ array
+	 */
+	return Node::createBin(op, type, n1, n2);
+    }
+    return bini(op, n1, n2, name);
+}
+
+/*
+ * handle the | |= operators
+ */
+Node *YYParser::_or(int op, Node *n1, Node *n2, const char *name)
+{
+    unsigned short type;
+
+    if (n1->type == N_INT && n2->type == N_INT) {
+	/* i | i */
+	n1->l.number |= n2->l.number;
+	return n1;
+    }
+    if (((type=n1->mod) == T_MIXED && n2->mod == T_MIXED) ||
+	((type=Compile::matchType(n1->mod, n2->mod)) & T_REF) != 0) {
+	/*
+	 * possibly array | array
+	 */
+	return Node::createBin(op, type, n1, n2);
+    }
+    return bini(op, n1, n2, name);
+}
+
+/*
+ * handle the && operator
+ */
+Node *YYParser::land(Node *n1, Node *n2)
+{
+    _void(n1);
+    _void(n2);
+
+    if ((n1->flags & F_CONST) && (n2->flags & F_CONST)) {
+	n1 = Compile::tst(n1);
+	n2 = Compile::tst(n2);
+	n1->l.number &= n2->l.number;
+	return n1;
+    }
+
+    return Node::createBin(N_LAND, T_INT, n1, n2);
+}
+
+/*
+ * handle the || operator
+ */
+Node *YYParser::lor(Node *n1, Node *n2)
+{
+    _void(n1);
+    _void(n2);
+
+    if ((n1->flags & F_CONST) && (n2->flags & F_CONST)) {
+	n1 = Compile::tst(n1);
+	n2 = Compile::tst(n2);
+	n1->l.number |= n2->l.number;
+	return n1;
+    }
+
+    return Node::createBin(N_LOR, T_INT, n1, n2);
+}
+
+/*
+ * handle the ? : operator
+ */
+Node *YYParser::quest(Node *n1, Node *n2, Node *n3)
+{
+    unsigned short type;
+
+    _void(n1);
+
+    if ((n2->flags & F_CONST) && n3->type == n2->type) {
+	switch (n1->type) {
+	case N_INT:
+	    return (n1->l.number == 0) ? n3 : n2;
+
+	case N_FLOAT:
+	    return (NFLT_ISZERO(n1)) ? n3 : n2;
+
+	case N_STR:
+	    return n2;
+
+	case N_NIL:
+	    return n3;
+	}
+    }
+
+    type = T_MIXED;
+    if (Compile::nil(n2) && T_POINTER(n3->mod) && n3->mod < T_MIXED) {
+	/*
+	 * expr ? nil : expr
+	 */
+	type = n3->mod;
+    } else if (Compile::nil(n3) && T_POINTER(n2->mod) && n2->mod < T_MIXED) {
+	/*
+	 * expr ? expr : nil;
+	 */
+	type = n2->mod;
+    } else if (typechecking) {
+	/*
+	 * typechecked
+	 */
+	if (n2->mod == T_VOID || n3->mod == T_VOID) {
+	    /* result can never be used */
+	    type = T_VOID;
+	} else {
+	    type = Compile::matchType(n2->mod, n3->mod);
+	    if (type == T_NIL) {
+		/* no typechecking here, just let the result be mixed */
+		type = T_MIXED;
+	    }
+	}
+    }
+
+    n1 = Node::createBin(N_QUEST, type, n1, Node::createBin(N_PAIR, 0, n2, n3));
+    if ((type & T_TYPE) == T_CLASS) {
+	if (n2->sclass == (String *) NULL) {
+	    n1->sclass = n3->sclass;
+	    if (n1->sclass != (String *) NULL) {
+		n1->sclass->ref();
+	    }
+	} else if (n3->sclass == (String *) NULL ||
+		   n2->sclass->cmp(n3->sclass) == 0) {
+	    n1->sclass = n2->sclass;
+	    if (n1->sclass != (String *) NULL) {
+		n1->sclass->ref();
+	    }
+	} else {
+	    /* downgrade to object */
+	    n1->type = (n1->type & T_REF) | T_OBJECT;
+	}
+    }
+    return n1;
+}
+
+/*
+ * handle the assignment operator
+ */
+Node *YYParser::assign(Node *n1, Node *n2)
+{
+    char tnbuf1[TNBUFSIZE], tnbuf2[TNBUFSIZE];
+    Node *n, *m;
+    unsigned short type;
+
+    if (n1->type == N_AGGR) {
+	/*
+	 * ({ a, b }) = array;
+	 */
+	if (typechecking) {
+	    type = n2->mod;
+	    if ((n2->mod & T_REF) != 0) {
+		type -= 1 << REFSHIFT;
+		if (type != T_MIXED) {
+		    n = Node::createMon(N_TYPE, type, (Node *) NULL);
+		    n->sclass = n2->sclass;
+		    if (n->sclass != (String *) NULL) {
+			n->sclass->ref();
+		    }
+		    n1->r.right = n;
+		}
+	    } else if (type != T_MIXED) {
+		Compile::error("incompatible types for = (%s, %s)",
+			       Value::typeName(tnbuf1, n1->mod),
+			       Value::typeName(tnbuf2, type));
+		type = T_MIXED;
+	    }
+
+	    n = n1->l.left;
+	    while (n != (Node *) NULL) {
+		if (n->type == N_PAIR) {
+		    m = n->l.left;
+		    n = n->r.right;
+		} else {
+		    m = n;
+		    n = (Node *) NULL;
+		}
+		if (Compile::matchType(m->mod, type) == T_NIL) {
+		    Compile::error("incompatible types for = (%s, %s)",
+				   Value::typeName(tnbuf1, m->mod),
+				   Value::typeName(tnbuf2, type));
+		}
+	    }
+	}
+	n1 = Node::createBin(N_ASSIGN, n2->mod, n1, n2);
+	n1->sclass = n2->sclass;
+	if (n1->sclass != (String *) NULL) {
+	    n1->sclass->ref();
+	}
+	return n1;
+    } else {
+	if (typechecking && (!Compile::nil(n2) || !T_POINTER(n1->mod))) {
+	    /*
+	     * typechecked
+	     */
+	    if (Compile::matchType(n1->mod, n2->mod) == T_NIL) {
+		Compile::error("incompatible types for = (%s, %s)",
+			       Value::typeName(tnbuf1, n1->mod),
+			       Value::typeName(tnbuf2, n2->mod));
+	    } else if ((n1->mod != T_MIXED && n2->mod == T_MIXED) ||
+		       (n1->mod == T_CLASS &&
+			(n2->mod != T_CLASS ||
+			 n1->sclass->cmp(n2->sclass) != 0))) {
+		n2 = Node::createMon(N_CAST, n1->mod, n2);
+		n2->sclass = n1->sclass;
+		if (n2->sclass != (String *) NULL) {
+		    n2->sclass->ref();
+		}
+	    }
+	}
+
+	n2 = Node::createBin(N_ASSIGN, n1->mod, n1, n2);
+	n2->sclass = n1->sclass;
+	if (n2->sclass != (String *) NULL) {
+	    n2->sclass->ref();
+	}
+	return n2;
+    }
+}
+
+/*
+ * handle the comma operator, rearranging the order of the
+ * expression if needed
+ */
+Node *YYParser::comma(Node *n1, Node *n2)
+{
+    if (n2->type == N_COMMA) {
+	/* a, (b, c) --> (a, b), c */
+	n2->l.left = comma(n1, n2->l.left);
+	return n2;
+    } else {
+	n1 = Node::createBin(N_COMMA, n2->mod, n1, n2);
+	n1->sclass = n2->sclass;
+	    if (n1->sclass != (String *) NULL) {
+		n1->sclass->ref();
+	    }
+	return n1;
+    }
+}
@@ -0,0 +1,224 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    NOMASK = 258,                  /* NOMASK  */
+    BREAK = 259,                   /* BREAK  */
+    DO = 260,                      /* DO  */
+    MAPPING = 261,                 /* MAPPING  */
+    ELSE = 262,                    /* ELSE  */
+    CASE = 263,                    /* CASE  */
+    OBJECT = 264,                  /* OBJECT  */
+    DEFAULT = 265,                 /* DEFAULT  */
+    FLOAT = 266,                   /* FLOAT  */
+    CONTINUE = 267,                /* CONTINUE  */
+    STATIC = 268,                  /* STATIC  */
+    INT = 269,                     /* INT  */
+    FOR = 270,                     /* FOR  */
+    IF = 271,                      /* IF  */
+    OPERATOR = 272,                /* OPERATOR  */
+    INHERIT = 273,                 /* INHERIT  */
+    RLIMITS = 274,                 /* RLIMITS  */
+    GOTO = 275,                    /* GOTO  */
+    FUNCTION = 276,                /* FUNCTION  */
+    RETURN = 277,                  /* RETURN  */
+    MIXED = 278,                   /* MIXED  */
+    WHILE = 279,                   /* WHILE  */
+    STRING = 280,                  /* STRING  */
+    TRY = 281,                     /* TRY  */
+    PRIVATE = 282,                 /* PRIVATE  */
+    VOID = 283,                    /* VOID  */
+    NEW = 284,                     /* NEW  */
+    CATCH = 285,                   /* CATCH  */
+    ATOMIC = 286,                  /* ATOMIC  */
+    NIL = 287,                     /* NIL  */
+    SWITCH = 288,                  /* SWITCH  */
+    VARARGS = 289,                 /* VARARGS  */
+    LARROW = 290,                  /* LARROW  */
+    RARROW = 291,                  /* RARROW  */
+    PLUS_PLUS = 292,               /* PLUS_PLUS  */
+    MIN_MIN = 293,                 /* MIN_MIN  */
+    LSHIFT = 294,                  /* LSHIFT  */
+    RSHIFT = 295,                  /* RSHIFT  */
+    LE = 296,                      /* LE  */
+    GE = 297,                      /* GE  */
+    EQ = 298,                      /* EQ  */
+    NE = 299,                      /* NE  */
+    LAND = 300,                    /* LAND  */
+    LOR = 301,                     /* LOR  */
+    PLUS_EQ = 302,                 /* PLUS_EQ  */
+    MIN_EQ = 303,                  /* MIN_EQ  */
+    MULT_EQ = 304,                 /* MULT_EQ  */
+    DIV_EQ = 305,                  /* DIV_EQ  */
+    MOD_EQ = 306,                  /* MOD_EQ  */
+    LSHIFT_EQ = 307,               /* LSHIFT_EQ  */
+    RSHIFT_EQ = 308,               /* RSHIFT_EQ  */
+    AND_EQ = 309,                  /* AND_EQ  */
+    XOR_EQ = 310,                  /* XOR_EQ  */
+    OR_EQ = 311,                   /* OR_EQ  */
+    COLON_COLON = 312,             /* COLON_COLON  */
+    DOT_DOT = 313,                 /* DOT_DOT  */
+    ELLIPSIS = 314,                /* ELLIPSIS  */
+    STRING_CONST = 315,            /* STRING_CONST  */
+    IDENTIFIER = 316,              /* IDENTIFIER  */
+    INT_CONST = 317,               /* INT_CONST  */
+    FLOAT_CONST = 318,             /* FLOAT_CONST  */
+    MARK = 319,                    /* MARK  */
+    HASH = 320,                    /* HASH  */
+    HASH_HASH = 321,               /* HASH_HASH  */
+    INCL_CONST = 322,              /* INCL_CONST  */
+    NR_TOKENS = 323                /* NR_TOKENS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define NOMASK 258
+#define BREAK 259
+#define DO 260
+#define MAPPING 261
+#define ELSE 262
+#define CASE 263
+#define OBJECT 264
+#define DEFAULT 265
+#define FLOAT 266
+#define CONTINUE 267
+#define STATIC 268
+#define INT 269
+#define FOR 270
+#define IF 271
+#define OPERATOR 272
+#define INHERIT 273
+#define RLIMITS 274
+#define GOTO 275
+#define FUNCTION 276
+#define RETURN 277
+#define MIXED 278
+#define WHILE 279
+#define STRING 280
+#define TRY 281
+#define PRIVATE 282
+#define VOID 283
+#define NEW 284
+#define CATCH 285
+#define ATOMIC 286
+#define NIL 287
+#define SWITCH 288
+#define VARARGS 289
+#define LARROW 290
+#define RARROW 291
+#define PLUS_PLUS 292
+#define MIN_MIN 293
+#define LSHIFT 294
+#define RSHIFT 295
+#define LE 296
+#define GE 297
+#define EQ 298
+#define NE 299
+#define LAND 300
+#define LOR 301
+#define PLUS_EQ 302
+#define MIN_EQ 303
+#define MULT_EQ 304
+#define DIV_EQ 305
+#define MOD_EQ 306
+#define LSHIFT_EQ 307
+#define RSHIFT_EQ 308
+#define AND_EQ 309
+#define XOR_EQ 310
+#define OR_EQ 311
+#define COLON_COLON 312
+#define DOT_DOT 313
+#define ELLIPSIS 314
+#define STRING_CONST 315
+#define IDENTIFIER 316
+#define INT_CONST 317
+#define FLOAT_CONST 318
+#define MARK 319
+#define HASH 320
+#define HASH_HASH 321
+#define INCL_CONST 322
+#define NR_TOKENS 323
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 101 "parser.y"
+
+    LPCint number;		/* lex input */
+    Float real;			/* lex input */
+    unsigned short type;	/* internal */
+    class Node *node;		/* internal */
+
+#line 210 "y.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
@@ -1365,7 +1365,7 @@ Node *YYParser::range(Node *n1, Node *n2, Node *n3)
 	/* str [ int .. int ] */
 	from = (n2 == (Node *) NULL) ? 0 : n2->l.number;
 	to = (n3 == (Node *) NULL) ? n1->l.string->len - 1 : n3->l.number;
-	if (from < 0 || from > to + 1 || to >= n1->l.string->len) {
+	if (from < 0 || from > to + 1 || to >= (LPCint) n1->l.string->len) {
 	    Compile::error("invalid string range");
 	} else {
 	    return Node::createStr(n1->l.string->range(from, to));
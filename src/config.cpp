@@ -38,11 +38,15 @@
 # include "parser.h"
 # include "compile.h"
 # include "table.h"
+# ifdef FORKDUMP
+# include <errno.h>
+# include <sys/wait.h>
+# endif
 
 static Config conf[] = {
 # define ARRAY_SIZE	0
 				{ "array_size",		INT_CONST, FALSE, FALSE,
-							1, USHRT_MAX / 2 },
+							1, SSIZET_MAX / 2 },
 # define AUTO_OBJECT	1
 				{ "auto_object",	STRING_CONST, TRUE },
 # define BINARY_PORT	2
@@ -102,16 +106,20 @@ static Config conf[] = {
 # define SWAP_SIZE	24
 				{ "swap_size",		INT_CONST, FALSE, FALSE,
 							1024, SW_UNUSED },
-# define TELNET_PORT	25
+# define SWAP_TIME	25
+				{ "swap_time",		INT_CONST },
+# define SWAP_WATERMARK	26
+				{ "swap_watermark",	INT_CONST },
+# define TELNET_PORT	27
 				{ "telnet_port",	'[', FALSE, FALSE,
 							1, USHRT_MAX },
-# define TYPECHECKING	26
+# define TYPECHECKING	28
 				{ "typechecking",	INT_CONST, FALSE, FALSE,
 							0, 2 },
-# define USERS		27
+# define USERS		29
 				{ "users",		INT_CONST, FALSE, FALSE,
 							0, EINDEX_MAX },
-# define NR_OPTIONS	28
+# define NR_OPTIONS	30
 };
 
 
@@ -122,7 +130,7 @@ struct alignl { char fill; int64_t l;	};
 struct alignp { char fill; char *p;	};
 struct alignz { char c;			};
 
-# define FORMAT_VERSION	18
+# define FORMAT_VERSION	21
 
 # define DUMP_TYPE	4	/* first XX bytes, dump type */
 # define DUMP_HEADERSZ	28	/* header size */
@@ -142,6 +150,10 @@ static int ealign;		/* align(eindex) */
 static int falign;		/* align(cindex) */
 static int palign;		/* align(char*) */
 static SnapshotInfo rheader;	/* restored header */
+# ifdef FORKDUMP
+static pid_t dumper;		/* process writing a snapshot */
+static int dumpstat = -1;	/* outcome of background snapshot */
+# endif
 static int rusize;		/* sizeof(uindex) */
 static int rtsize;		/* sizeof(ssizet) */
 static int rdsize;		/* sizeof(sector) */
@@ -256,13 +268,46 @@ void Config::dumpinit()
     falign = (sizeof(cindex) == sizeof(short)) ? salign : ialign;
 }
 
+# ifdef FORKDUMP
 /*
- * dump system state on file
+ * collect the process writing a snapshot in the background, if it has
+ * finished.  If wait is TRUE, wait for it to finish
  */
-void Config::dump(bool incr, bool boot)
+static void reap(bool wait)
+{
+    pid_t pid;
+    int status;
+
+    if (dumper > 0) {
+	do {
+	    pid = waitpid(dumper, &status, (wait) ? 0 : WNOHANG);
+	} while (pid < 0 && errno == EINTR);
+	if (pid != 0) {
+	    dumper = 0;
+	    Swap::thaw();
+	    dumpstat = (pid > 0 && WIFEXITED(status) &&
+			WEXITSTATUS(status) == 0);
+	}
+    }
+}
+# endif
+
+/*
+ * dump system state on file.  A full snapshot is written in the background
+ * if bg is TRUE and it can be; return TRUE if the swap file became the
+ * snapshot
+ */
+bool Config::dump(bool incr, bool boot, bool bg)
 {
     int fd;
     Uint etime;
+# ifdef FORKDUMP
+    bool child;
+
+    reap(TRUE);		/* one snapshot at a time */
+# else
+    UNREFERENCED_PARAMETER(bg);
+# endif
 
     header.version = FORMAT_VERSION;
     header.typecheck = conf[TYPECHECKING].num;
@@ -283,6 +328,24 @@ void Config::dump(bool incr, bool boot)
     if (!incr) {
 	Object::copy(0);
     }
+# ifdef FORKDUMP
+    child = FALSE;
+    if (bg && !incr && !boot && Swap::freeze()) {
+	dumper = fork();
+	if (dumper > 0) {
+	    return FALSE;	/* the child process writes the snapshot */
+	}
+	if (dumper == 0) {
+	    /* the child has no use for connections and ports */
+	    Comm::clear();
+	    Comm::finish();
+	    Swap::detach(conf[DUMP_FILE].str);
+	    child = TRUE;
+	} else {
+	    Swap::thaw();
+	}
+    }
+# endif
     Dataspace::swapout(1);
     header.dflags = 0;
     if (Object::dobjects() > 0) {
@@ -306,6 +369,44 @@ void Config::dump(bool incr, bool boot)
     }
 
     Swap::save2(&header, sizeof(SnapshotInfo), incr);
+# ifdef FORKDUMP
+    if (child) {
+	_exit(0);
+    }
+# endif
+    return !incr;
+}
+
+/*
+ * return the outcome of a background snapshot that has finished: 1 if it
+ * succeeded, 0 if it failed, or -1 if there is nothing to report.  If wait
+ * is TRUE, wait for a snapshot still being written
+ */
+int Config::dumped(bool wait)
+{
+# ifdef FORKDUMP
+    int status;
+
+    reap(wait);
+    status = dumpstat;
+    dumpstat = -1;
+    return status;
+# else
+    UNREFERENCED_PARAMETER(wait);
+    return -1;
+# endif
+}
+
+/*
+ * is a snapshot being written in the background?
+ */
+bool Config::dumping()
+{
+# ifdef FORKDUMP
+    return (dumper > 0);
+# else
+    return FALSE;
+# endif
 }
 
 /*
@@ -313,11 +414,12 @@ void Config::dump(bool incr, bool boot)
  */
 bool Config::restore(int fd, int fd2)
 {
-    bool conv_14, conv_15, conv_16, conv_17;
+    bool conv_14, conv_15, conv_16, conv_17, conv_18, conv_19, conv_20;
     unsigned int secsize;
 
     secsize = rheader.restore(fd);
-    conv_14 = conv_15 = conv_16 = conv_17 = FALSE;
+    conv_14 = conv_15 = conv_16 = conv_17 = conv_18 = conv_19 = conv_20 =
+	      FALSE;
     if (rheader.version < 15) {
 	if (!(rheader.dflags & FLAGS_COMP159)) {
 	    EC->error("Snapshot contains legacy programs");
@@ -333,6 +435,15 @@ bool Config::restore(int fd, int fd2)
     if (rheader.version < 18) {
 	conv_17 = TRUE;
     }
+    if (rheader.version < 19) {
+	conv_18 = TRUE;
+    }
+    if (rheader.version < 20) {
+	conv_19 = TRUE;
+    }
+    if (rheader.version < 21) {
+	conv_20 = TRUE;
+    }
     header.version = rheader.version;
     if (memcmp(&header, &rheader, DUMP_TYPE) != 0 || rheader.zero1 != 0 ||
 	rheader.zero2 != 0 || rheader.zero3 != 0 || rheader.zero4 != 0) {
@@ -404,11 +515,12 @@ bool Config::restore(int fd, int fd2)
     }
     rheader.psize &= 0xf;
 
-    Swap::restore(fd, secsize);
+    Swap::restore(fd, secsize, conv_18);
     KFun::restore(fd);
     Object::restore(fd, rheader.dflags & FLAGS_PARTIAL);
-    Dataspace::initConv(conv_14, conv_16, conv_17, (sizeof(LPCint) != rnsize));
-    Control::initConv(conv_14, conv_15, conv_16);
+    Dataspace::initConv(conv_14, conv_16, conv_17, conv_20,
+			(sizeof(LPCint) != rnsize));
+    Control::initConv(conv_14, conv_15, conv_16, conv_20);
     if (conv_14) {
 	struct {
 	    uindex nprecomps;
@@ -427,7 +539,7 @@ bool Config::restore(int fd, int fd2)
 	}
     }
     boottime = P_time();
-    CallOut::restore(fd, boottime, conv_16);
+    CallOut::restore(fd, boottime, conv_16, conv_19);
 
     if (fd2 >= 0) {
 	P_close(fd2);
@@ -1205,7 +1317,8 @@ bool Config::config()
 
     for (l = 0; l < NR_OPTIONS; l++) {
 	if (!conf[l].set && l != HOTBOOT && l != MODULES && l != CACHE_SIZE &&
-	    l != DATAGRAM_PORT && l != DATAGRAM_USERS) {
+	    l != DATAGRAM_PORT && l != DATAGRAM_USERS && l != SWAP_TIME &&
+	    l != SWAP_WATERMARK) {
 	    char buffer[64];
 
 	    snprintf(buffer, sizeof(buffer), "unspecified option %s",
@@ -1377,6 +1490,21 @@ bool Config::includes()
     puts("# define ST_TELNETPORTS\t25\t/* telnet ports */\012");
     puts("# define ST_BINARYPORTS\t26\t/* binary ports */\012");
     puts("# define ST_NUSERS\t27\t/* # users (including datagram) */\012");
+    puts("# define ST_NOUTPUT\t28\t/* # messages and datagrams sent */\012");
+    puts("# define ST_NOUTCALLS\t29\t/* # system calls used for output */\012");
+    puts("# define ST_CALLHITS\t30\t/* # call_other cache hits */\012");
+    puts("# define ST_CALLMISSES\t31\t/* # call_other cache misses */\012");
+    puts("# define ST_DMEMSLAB\t32\t/* dynamic memory in slabs */\012");
+    puts("# define ST_DMEMSLABUSED 33\t/* slab memory in use */\012");
+    puts("# define ST_HUGEMEM\t34\t/* memory in explicit huge pages */\012");
+    puts("# define ST_THPMEM\t35\t/* memory in transparent huge pages */\012");
+    puts("# define ST_SWAPCLEAN\t36\t/* # clean objects swapped out */\012");
+    puts("# define ST_SWAPDIRTY\t37\t/* # changed objects swapped out */\012");
+    puts("# define ST_SWAPCUT\t38\t/* # swapouts cut short by swap_time */\012");
+    puts("# define ST_GCCYCLES\t39\t/* # incremental collections */\012");
+    puts("# define ST_GCABORTED\t40\t/* # incremental collections abandoned */\012");
+    puts("# define ST_GCRECLAIMED\t41\t/* memory reclaimed by collections */\012");
+    puts("# define ST_GCLAST\t42\t/* memory reclaimed by last collection */\012");
 
     puts("\012# define O_COMPILETIME\t0\t/* time of compilation */\012");
     puts("# define O_PROGSIZE\t1\t/* program size of object */\012");
@@ -1506,6 +1634,10 @@ bool Config::includes()
     puts("# define TRACE_LINE\t3\t/* line number */\012");
     puts("# define TRACE_EXTERNAL\t4\t/* external call flag */\012");
     puts("# define TRACE_FIRSTARG\t5\t/* first argument to function */\012");
+    puts("\012/* metrics for the profile() function */\012");
+    puts("# define PROF_TICKS\t0\t/* ticks spent */\012");
+    puts("# define PROF_TIME\t1\t/* wall time spent, in microseconds */\012");
+    puts("# define PROF_MEMORY\t2\t/* dynamic memory allocated, in bytes */\012");
     if (!close()) {
 	return FALSE;
     }
@@ -1677,7 +1809,8 @@ bool Config::init(char *configfile, char *snapshot, char *snapshot2,
 	return FALSE;
     }
 
-    /* initialize arrays */
+    /* initialize strings and arrays */
+    String::init();
     Array::init((int) conf[ARRAY_SIZE].num);
 
     /* initialize objects */
@@ -1689,7 +1822,8 @@ bool Config::init(char *configfile, char *snapshot, char *snapshot2,
 	       (unsigned int) conf[SECTOR_SIZE].num);
 
     /* initialize swapped data handler */
-    Dataspace::init();
+    Dataspace::init((Uint) conf[SWAP_TIME].num,
+		    (size_t) conf[SWAP_WATERMARK].num);
     Control::init();
     *fragment = conf[SWAP_FRAGMENT].num;
 
@@ -1698,7 +1832,7 @@ bool Config::init(char *configfile, char *snapshot, char *snapshot2,
 		 (int) conf[EDITORS].num);
 
     /* initialize call_outs */
-    if (!CallOut::init((uindex) conf[CALL_OUTS].num)) {
+    if (!CallOut::init((cindex) conf[CALL_OUTS].num)) {
 	Swap::finish();
 	Comm::clear();
 	Comm::finish();
@@ -1875,7 +2009,7 @@ bool Config::attach(int port)
 /*
  * return the maximum array size
  */
-unsigned short Config::arraySize()
+ssizet Config::arraySize()
 {
     return conf[ARRAY_SIZE].num;
 }
@@ -1905,6 +2039,8 @@ bool Config::statusi(Frame *f, LPCint idx, Value *v)
 {
     const char *version;
     cindex ncoshort, ncolong;
+    size_t messages, syscalls, hits, misses, clean, dirty, cut;
+    size_t cycles, aborts, reclaimed, last;
     Array *a;
     Uint t;
     int i;
@@ -2041,6 +2177,77 @@ bool Config::statusi(Frame *f, LPCint idx, Value *v)
 	PUT_INTVAL(v, Comm::numUsers());
 	break;
 
+    case 28:	/* ST_NOUTPUT */
+	Comm::info(&messages, &syscalls);
+	putval(v, messages);
+	break;
+
+    case 29:	/* ST_NOUTCALLS */
+	Comm::info(&messages, &syscalls);
+	putval(v, syscalls);
+	break;
+
+    case 30:	/* ST_CALLHITS */
+	Frame::callInfo(&hits, &misses);
+	putval(v, hits);
+	break;
+
+    case 31:	/* ST_CALLMISSES */
+	Frame::callInfo(&hits, &misses);
+	putval(v, misses);
+	break;
+
+    case 32:	/* ST_DMEMSLAB */
+	putval(v, MM->info()->dmemslab);
+	break;
+
+    case 33:	/* ST_DMEMSLABUSED */
+	putval(v, MM->info()->dmemslabused);
+	break;
+
+    case 34:	/* ST_HUGEMEM */
+	putval(v, MM->info()->hugemem);
+	break;
+
+    case 35:	/* ST_THPMEM */
+	putval(v, MM->info()->thpmem);
+	break;
+
+    case 36:	/* ST_SWAPCLEAN */
+	Dataspace::swapInfo(&clean, &dirty, &cut);
+	putval(v, clean);
+	break;
+
+    case 37:	/* ST_SWAPDIRTY */
+	Dataspace::swapInfo(&clean, &dirty, &cut);
+	putval(v, dirty);
+	break;
+
+    case 38:	/* ST_SWAPCUT */
+	Dataspace::swapInfo(&clean, &dirty, &cut);
+	putval(v, cut);
+	break;
+
+    case 39:	/* ST_GCCYCLES */
+	Dataspace::gcInfo(&cycles, &aborts, &reclaimed, &last);
+	putval(v, cycles);
+	break;
+
+    case 40:	/* ST_GCABORTED */
+	Dataspace::gcInfo(&cycles, &aborts, &reclaimed, &last);
+	putval(v, aborts);
+	break;
+
+    case 41:	/* ST_GCRECLAIMED */
+	Dataspace::gcInfo(&cycles, &aborts, &reclaimed, &last);
+	putval(v, reclaimed);
+	break;
+
+    case 42:	/* ST_GCLAST */
+	Dataspace::gcInfo(&cycles, &aborts, &reclaimed, &last);
+	putval(v, last);
+	break;
+
     default:
 	return FALSE;
     }
@@ -2059,8 +2266,8 @@ Array *Config::status(Frame *f)
 
     try {
 	EC->push();
-	a = Array::createNil(f->data, 28);
-	for (i = 0, v = a->elts; i < 28; i++, v++) {
+	a = Array::createNil(f->data, 43);
+	for (i = 0, v = a->elts; i < 43; i++, v++) {
 	    statusi(f, i, v);
 	}
 	EC->pop();
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -24,30 +24,44 @@
  * SECTOR limits the number of swap sectors (the size of a snapshot)
  * CINDEX limits the number of callouts
  * EINDEX limits the number of connected users
- * SSIZET limits the length of a string (best kept at 16 bits)
+ * SSIZET limits the length of a string and the size of an array or mapping
  *
- * default: 64K objects, 64K swap sectors, 255 users, max string length 64K
+ * default: 64K objects, 64K swap sectors, 4G callouts, 255 users,
+ * max string length 64K, max array size 32K
+ *
+ * LARGEINDEX: 4G objects, 4G swap sectors
+ * LARGESIZE: max string length 2G, max array size 1G
  */
 # ifndef UINDEX_TYPE
+# ifdef LARGEINDEX
+# define UINDEX_TYPE	unsigned int
+# define UINDEX_MAX	UINT_MAX
+# else
 # define UINDEX_TYPE	unsigned short
 # define UINDEX_MAX	USHRT_MAX
 # endif
+# endif
 # ifndef SECTOR_TYPE
 # define SECTOR_TYPE	UINDEX_TYPE
 # define SECTOR_MAX	UINDEX_MAX
 # endif
 # ifndef CINDEX_TYPE
-# define CINDEX_TYPE	UINDEX_TYPE
-# define CINDEX_MAX	UINDEX_MAX
+# define CINDEX_TYPE	unsigned int
+# define CINDEX_MAX	UINT_MAX
 # endif
 # ifndef EINDEX_TYPE
 # define EINDEX_TYPE	unsigned char
 # define EINDEX_MAX	UCHAR_MAX
 # endif
 # ifndef SSIZET_TYPE
+# ifdef LARGESIZE
+# define SSIZET_TYPE	unsigned int
+# define SSIZET_MAX	INT_MAX		/* sizes must fit in an LPC int */
+# else
 # define SSIZET_TYPE	unsigned short
 # define SSIZET_MAX	USHRT_MAX
 # endif
+# endif
 
 typedef UINDEX_TYPE uindex;
 typedef SECTOR_TYPE Sector;
@@ -60,7 +74,7 @@ typedef SSIZET_TYPE ssizet;
 # ifdef LARGENUM
 
 # if UINDEX_MAX == USHRT_MAX
-# error LARGENUM requires uindex of 4 bytes or more
+# error LARGENUM requires LARGEINDEX, or uindex of 4 bytes or more
 # endif
 
 typedef int64_t LPCint;
@@ -98,13 +112,15 @@ typedef unsigned short kfindex;
 # define BUF_SIZE	FS_BLOCK_SIZE	/* I/O buffer size */
 # define MAX_LINE_SIZE	4096	/* max. line size in ed and lex (power of 2) */
 # define STRINGSZ	256	/* general (internal) string size */
-# define STRMAPHASHSZ	20	/* # characters to hash of map string indices */
 # define STRMERGETABSZ	1024	/* general string merge table size */
 # define STRMERGEHASHSZ	20	/* # characters in merge strings to hash */
 # define ARRMERGETABSZ	1031	/* general array merge table size */
 # define OBJHASHSZ	256	/* # characters in object names to hash */
 # define COPATCHHTABSZ	1031	/* callout patch hash table size */
 # define OBJPATCHHTABSZ	257	/* object patch hash table size */
+# define HASHGROWLEN	8	/* hash chain length that triggers growth */
+# define HASHGROWMAX	16	/* max. growth factor of a hash table */
+# define HASHMIGRATE	4	/* # buckets rehashed per lookup when growing */
 # define CMPLIMIT	2048	/* compress strings if >= CMPLIMIT */
 # define SWAPCHUNKSZ	10	/* # objects reconstructed in main loop */
 
@@ -122,6 +138,9 @@ typedef unsigned short kfindex;
 # define EXTRA_STACK	32	/* extra space in stack frames */
 # define MAX_STRLEN	SSIZET_MAX	/* max string length, >= 65535 */
 # define INHASHSZ	4099	/* instanceof hashtable size */
+# define CALLCACHESZ	1021	/* call_other cache size */
+# define CALLNAMESZ	28	/* max function name length in call_other cache */
+# define PROFTABSZ	1024	/* profile hashtable size */
 
 /* parser */
 # define MAX_AUTOMSZ	6	/* DFA/PDA storage size, in strings */
@@ -192,10 +211,12 @@ public:
     static char	*driver();
     static char	**hotbootExec();
     static int typechecking();
-    static unsigned short arraySize();
+    static ssizet arraySize();
     static bool attach(int port);
 
-    static void dump(bool incr, bool boot);
+    static bool dump(bool incr, bool boot, bool bg);
+    static int dumped(bool wait);
+    static bool dumping();
     static Uint dsize(const char *layout);
     static Uint dconv(char *buf, char *rbuf, const char *layout, Uint n);
     static void dread(int fd, char *buf, const char *layout, Uint n);
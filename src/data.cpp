@@ -456,14 +456,12 @@ void Dataplane::commitCallouts(bool merge)
 			break;
 
 		    case COP_REMOVE:
-			CallOut::del(alocal.data->oindex, cop->handle,
-				     cop->rco.time, cop->rco.mtime);
+			CallOut::del(alocal.data->oindex, cop->handle);
 			ncallout++;
 			break;
 
 		    case COP_REPLACE:
-			CallOut::del(alocal.data->oindex, cop->handle,
-				     cop->rco.time, cop->rco.mtime);
+			CallOut::del(alocal.data->oindex, cop->handle);
 			CallOut::create(alocal.data->oindex, cop->handle,
 					cop->time, cop->mtime, cop->queue);
 			cop->commit();
@@ -834,6 +832,75 @@ static Dataspace *dhead, *dtail;	/* list of dataspace blocks */
 static Dataspace *gcdata;		/* next dataspace to garbage collect */
 static Dataspace *ifirst;		/* list of dataspaces with imports */
 static Sector ndata;			/* # dataspace blocks */
+static Uint swaptime;			/* swapout time budget in ms */
+static size_t swapmark;			/* swapout memory watermark */
+static size_t swclean;			/* # clean dataspaces swapped out */
+static size_t swdirty;			/* # dirty dataspaces swapped out */
+static size_t swcut;			/* # swapouts cut short */
+
+# define GCWORK		8192	/* incremental GC work per task */
+
+# define GC_IDLE	0	/* no collection in progress */
+# define GC_VARS	1	/* marking from variables */
+# define GC_CALLOUTS	2	/* marking from callouts */
+# define GC_ARRAYS	3	/* marking from arrays loaded from swap */
+# define GC_MARK	4	/* marking */
+# define GC_SWEEP	5	/* sweeping */
+
+static Dataspace *gctarget;		/* dataspace being collected */
+static int gcphase;			/* collection phase */
+static Uint gcindex;			/* index in roots */
+static Array **gcstack;			/* mark stack */
+static Uint gcsp, gcstacksz;		/* mark stack pointer and size */
+static Array **gcset;			/* hash set of marked arrays */
+static Uint gcsetn, gcsetsz;		/* # marked arrays, set size */
+static Array *gccursor;			/* sweep position */
+static Array gcgarbage;			/* garbage list sentinel */
+# define GCHASH(a)	((Uint) (((uint64_t) (uintptr_t) (a) *		      \
+				  0x9e3779b97f4a7c15ULL) >> 32) & (gcsetsz - 1))
+static size_t gccycles;			/* # collections completed */
+static size_t gcaborts;			/* # collections abandoned */
+static size_t gcreclaimed;		/* memory reclaimed in total */
+static size_t gclast;			/* memory reclaimed by last collection */
+
+/*
+ * end an incremental collection
+ */
+static void gcend()
+{
+    if (gcstack != (Array **) NULL) {
+	FREE(gcstack);
+	gcstack = (Array **) NULL;
+    }
+    if (gcset != (Array **) NULL) {
+	FREE(gcset);
+	gcset = (Array **) NULL;
+    }
+    gcsp = gcstacksz = 0;
+    gcsetn = gcsetsz = 0;
+    gcphase = GC_IDLE;
+    gctarget = (Dataspace *) NULL;
+}
+
+/*
+ * abandon the incremental collection of a dataspace that is about to change
+ */
+static void gcabort()
+{
+    if (gcgarbage.next != &gcgarbage) {
+	Array *alist;
+
+	/* put back the garbage found so far */
+	alist = &gctarget->alist;
+	gcgarbage.prev->next = alist->next;
+	alist->next->prev = gcgarbage.prev;
+	alist->next = gcgarbage.next;
+	gcgarbage.next->prev = alist;
+	gcgarbage.prev = gcgarbage.next = &gcgarbage;
+    }
+    gcaborts++;
+    gcend();
+}
 
 /*
  * allocate a new dataspace block
@@ -925,6 +992,10 @@ Dataspace *Dataspace::create(Object *obj)
  */
 void Dataspace::ref()
 {
+    if (this == gctarget) {
+	gcabort();
+    }
+    flags &= ~DATA_COLLECTED;
     if (this != dhead) {
 	/* move to head of list */
 	prev->next = next;
@@ -968,6 +1039,10 @@ void Dataspace::freeValues()
 {
     Uint i;
 
+    if (this == gctarget) {
+	gcabort();
+    }
+
     /* free parse_string data */
     if (parser != (Parser *) NULL) {
 	delete parser;
@@ -1210,10 +1285,10 @@ struct SArray {
     Uint tag;			/* unique value for each array */
     Uint ref;			/* refcount */
     char type;			/* array type */
-    unsigned short size;	/* size of array */
+    ssizet size;			/* size of array */
 };
 
-static char sa_layout[] = "iics";
+static char sa_layout[] = "iict";
 
 struct SArray0 {
     Uint index;			/* index in array value table */
@@ -1264,6 +1339,7 @@ static char sco0_layout[] = "issu[ccuI][ccuI][ccuI][ccuI]";
 static bool conv_14;			/* convert arrays & strings? */
 static bool conv_16;			/* convert callouts? */
 static bool conv_17;			/* convert dataspace? */
+static bool conv_20;			/* predictor compression only? */
 static bool conv_float;			/* convert floats? */
 static bool convDone;			/* conversion complete? */
 
@@ -1332,6 +1408,10 @@ Dataspace *Dataspace::load(Object *obj)
     Dataspace *data;
 
     data = load(obj, Swap::readv);
+    if (data->nsectors > 1) {
+	/* the rest of the dataspace will be loaded piecemeal */
+	Swap::prefetch(data->sectors + 1, data->nsectors - 1);
+    }
 
     if (!(obj->flags & O_MASTER) && obj->update != OBJ(obj->master)->update &&
 	obj->count != 0) {
@@ -1602,9 +1682,13 @@ Dataspace *Dataspace::conv(Object *obj, Uint *counttab,
 	}
 	if (header.strsize != 0) {
 	    if (header.flags & CMP_TYPE) {
+		if (conv_20 && (header.flags & CMP_TYPE) != CMP_PRED) {
+		    EC->fatal("bad compression in old snapshot");
+		}
 		data->stext = Swap::decompress(data->sectors, readv,
 					       header.strsize, size,
-					       &data->strsize);
+					       &data->strsize,
+					       header.flags & CMP_TYPE);
 	    } else {
 		data->stext = ALLOC(char, header.strsize);
 		(*readv)(data->stext, data->sectors, header.strsize, size);
@@ -1659,7 +1743,7 @@ void Dataspace::loadStrings(void (*readv) (char*, Sector*, Uint, Uint))
 	    if (flags & DATA_STRCMP) {
 		stext = Swap::decompress(sectors, readv, strsize,
 					 stroffset + nstrings * sizeof(SString),
-					 &strsize);
+					 &strsize, flags & DATA_STRCMP);
 	    } else {
 		stext = ALLOC(char, strsize);
 		(*readv)(stext, sectors, strsize,
@@ -1744,6 +1828,9 @@ Array *Dataspace::array(Uint idx, int type)
 	Dataplane *p;
 	Uint i;
 
+	if (this == gctarget) {
+	    gcabort();
+	}
 	if (sarrays == (SArray *) NULL) {
 	    /* load arrays */
 	    loadArrays(Swap::readv);
@@ -1921,6 +2008,9 @@ Value *Dataspace::elts(Array *arr)
 	Uint idx;
 
 	data = arr->primary->data;
+	if (data == gctarget) {
+	    gcabort();
+	}
 	if (data->selts == (SValue *) NULL) {
 	    data->loadElts(Swap::readv);
 	}
@@ -2056,7 +2146,7 @@ public:
     /*
      * save the values in an object
      */
-    void save(SValue *sv, Value *v, unsigned short n) {
+    void save(SValue *sv, Value *v, ssizet n) {
 	Uint i;
 
 	while (n > 0) {
@@ -2136,7 +2226,7 @@ private:
 /*
  * save modified values as svalues
  */
-void Dataspace::saveValues(SValue *sv, Value *v, unsigned short n)
+void Dataspace::saveValues(SValue *sv, Value *v, ssizet n)
 {
     while (n > 0) {
 	if (v->modified) {
@@ -2186,6 +2276,9 @@ bool Dataspace::save(bool swap)
     SDataspace header;
     Uint n;
 
+    if (this == gctarget) {
+	gcabort();
+    }
     if (parser != (Parser *) NULL && !(OBJ(oindex)->flags & O_SPECIAL)) {
 	parser->save();
     }
@@ -2455,9 +2548,10 @@ bool Dataspace::save(bool swap)
 	    text = save.stext;
 	    if (header.strsize >= CMPLIMIT) {
 		text = ALLOC(char, header.strsize);
-		size = Swap::compress(text, save.stext, header.strsize);
+		size = Swap::compress(text, save.stext, header.strsize,
+				      CMP_DEFAULT);
 		if (size != 0) {
-		    header.flags |= CMP_PRED;
+		    header.flags |= CMP_DEFAULT;
 		    header.strsize = size;
 		} else {
 		    FREE(text);
@@ -2746,7 +2840,7 @@ void Dataspace::delLhs(Value *lhs)
 void Dataspace::refImports(Array *arr)
 {
     Dataspace *data;
-    unsigned short n;
+    ssizet n;
     Value *v;
 
     data = arr->primary->data;
@@ -3221,7 +3315,7 @@ LPCint Dataspace::delCallOut(Uint handle, unsigned short *mtime)
 	/*
 	 * remove normal callout
 	 */
-	CallOut::del(oindex, (uindex) handle, co->time, co->mtime);
+	CallOut::del(oindex, (uindex) handle);
     } else {
 	COPatch **c, *cop;
 	COPatch **cc;
@@ -3366,7 +3460,7 @@ Array *Dataspace::listCallouts(Dataspace *data)
     DCallOut *co;
     Value *v, *v2, *elts;
     Array *list, *a;
-    uindex max_args;
+    ssizet max_args;
     Float flt;
 
     if (ncallouts == 0) {
@@ -3507,6 +3601,10 @@ void Dataspace::upgrade(unsigned int nvar, unsigned short *vmap, Object *tmpl)
     unsigned short n;
     Value *vars;
 
+    if (this == gctarget) {
+	gcabort();
+    }
+
     /* make sure variables are in memory */
     vars = variable(0);
 
@@ -3595,6 +3693,9 @@ Object *Dataspace::upgradeLWO(LWO *lwobj, Object *obj)
     Value *vars;
 
     a = lwobj->primary;
+    if (a->data == gctarget) {
+	gcabort();
+    }
     update = obj->update;
     vmap = varmap(&obj, (Uint) lwobj->elts[1].number, &nvar);
     --nvar;
@@ -3679,7 +3780,7 @@ struct ArrImport {
 /*
  * copy imported arrays to current dataspace
  */
-void Dataspace::import(ArrImport *imp, Value *val, unsigned short n)
+void Dataspace::import(ArrImport *imp, Value *val, ssizet n)
 {
     Array *import, *a;
 
@@ -3881,23 +3982,28 @@ void Dataspace::xport()
 /*
  * initialize swapped data handling
  */
-void Dataspace::init()
+void Dataspace::init(Uint time, size_t watermark)
 {
     dhead = dtail = (Dataspace *) NULL;
     gcdata = (Dataspace *) NULL;
     ndata = 0;
-    conv_14 = conv_16 = FALSE;
+    swaptime = time;
+    swapmark = watermark;
+    swclean = swdirty = swcut = 0;
+    conv_14 = conv_16 = conv_20 = FALSE;
     convDone = FALSE;
 }
 
 /*
  * prepare for conversions
  */
-void Dataspace::initConv(bool c14, bool c16, bool c17, bool cfloat)
+void Dataspace::initConv(bool c14, bool c16, bool c17, bool c20,
+			 bool cfloat)
 {
     conv_14 = c14;
     conv_16 = c16;
     conv_17 = c17;
+    conv_20 = c20;
     conv_float = cfloat;
 }
 
@@ -3909,46 +4015,380 @@ void Dataspace::converted()
     convDone = TRUE;
 }
 
+/*
+ * check if a dataspace must be written before it can be swapped out
+ */
+bool Dataspace::dirty()
+{
+    return (parser != (Parser *) NULL ||
+	    (base.flags & (MOD_ALL | MOD_SAVE)) != 0);
+}
+
+/*
+ * add an array to the set of marked arrays, and to the mark stack if it
+ * wasn't marked yet
+ */
+static void gcmark(Array *arr)
+{
+    Uint i;
+
+    if (gcsetn * 2 >= gcsetsz) {
+	Array **set;
+	Uint n;
+
+	/* grow the set */
+	set = gcset;
+	n = gcsetsz;
+	gcsetsz = (n == 0) ? 1024 : n << 1;
+	gcset = ALLOC(Array*, gcsetsz);
+	memset(gcset, '\0', gcsetsz * sizeof(Array*));
+	gcsetn = 0;
+	while (n > 0) {
+	    if (set[--n] != (Array *) NULL) {
+		for (i = GCHASH(set[n]); gcset[i] != (Array *) NULL;
+		     i = (i + 1) & (gcsetsz - 1)) ;
+		gcset[i] = set[n];
+		gcsetn++;
+	    }
+	}
+	if (set != (Array **) NULL) {
+	    FREE(set);
+	}
+    }
+
+    for (i = GCHASH(arr); gcset[i] != (Array *) NULL;
+	 i = (i + 1) & (gcsetsz - 1)) {
+	if (gcset[i] == arr) {
+	    return;	/* already marked */
+	}
+    }
+    gcset[i] = arr;
+    gcsetn++;
+
+    if (gcsp == gcstacksz) {
+	gcstack = REALLOC(gcstack, Array*, gcstacksz,
+			  (gcstacksz == 0) ? 256 : gcstacksz << 1);
+	gcstacksz = (gcstacksz == 0) ? 256 : gcstacksz << 1;
+    }
+    gcstack[gcsp++] = arr;
+}
+
+/*
+ * check if an array is marked
+ */
+static bool gcmarked(Array *arr)
+{
+    Uint i;
+
+    for (i = GCHASH(arr); gcset[i] != (Array *) NULL;
+	 i = (i + 1) & (gcsetsz - 1)) {
+	if (gcset[i] == arr) {
+	    return TRUE;
+	}
+    }
+    return FALSE;
+}
+
+/*
+ * mark the arrays referenced by values
+ */
+static void gcvalues(Value *v, Uint n)
+{
+    while (n > 0) {
+	if (T_INDEXED(v->type)) {
+	    gcmark(v->array);
+	}
+	v++;
+	--n;
+    }
+}
+
+/*
+ * free the garbage found by a collection
+ */
+static void gcfree()
+{
+    Array *arr;
+    Value *v;
+    ssizet n;
+
+    /* keep garbage alive while mappings are made canonical */
+    for (arr = gcgarbage.next; arr != &gcgarbage; arr = arr->next) {
+	arr->ref();
+    }
+    for (arr = gcgarbage.next; arr != &gcgarbage; arr = arr->next) {
+	arr->canonicalize();
+    }
+
+    /* remove references between garbage arrays */
+    for (arr = gcgarbage.next; arr != &gcgarbage; arr = arr->next) {
+	for (n = arr->size, v = arr->elts; n > 0; --n, v++) {
+	    if (T_INDEXED(v->type) && !gcmarked(v->array)) {
+		*v = nil;
+	    }
+	}
+    }
+
+    /* now the garbage can be deleted like any other array */
+    while ((arr=gcgarbage.next) != &gcgarbage) {
+	arr->refCount = 1;
+	arr->del();
+    }
+}
+
+/*
+ * check if a dataspace can be collected incrementally, rather than by
+ * saving it: it must have new arrays, which may have become garbage
+ */
+bool Dataspace::collectable()
+{
+    return (variables != (Value *) NULL && parser == (Parser *) NULL &&
+	    base.achange != 0 && base.imports == 0);
+}
+
+/*
+ * Do a bounded amount of work on the incremental collection of the
+ * arrays in a dataspace.  Arrays reachable from variables, callouts and
+ * arrays loaded from swap are marked; the others can only be kept alive by
+ * cycles, and are freed.  The collection is abandoned if the dataspace
+ * is used before it is complete.  Return TRUE if the collection was
+ * completed.
+ */
+bool Dataspace::collect(long work)
+{
+    Dataspace *data;
+    Array *arr;
+    size_t mem;
+
+    data = gctarget;
+    switch (gcphase) {
+    case GC_VARS:
+	while (gcindex < data->nvariables) {
+	    if (--work < 0) {
+		return FALSE;
+	    }
+	    gcvalues(&data->variables[gcindex++], 1);
+	}
+	gcindex = 0;
+	gcphase = GC_CALLOUTS;
+	/* fall through */
+    case GC_CALLOUTS:
+	if (data->callouts != (DCallOut *) NULL) {
+	    DCallOut *co;
+
+	    while (gcindex < data->ncallouts) {
+		if (--work < 0) {
+		    return FALSE;
+		}
+		co = &data->callouts[gcindex++];
+		if (co->val[0].type == T_STRING) {
+		    gcvalues(co->val, (co->nargs > 3) ? 4 : co->nargs + 1);
+		}
+	    }
+	}
+	gcindex = 0;
+	gcphase = GC_ARRAYS;
+	/* fall through */
+    case GC_ARRAYS:
+	if (data->base.arrays != (ArrRef *) NULL) {
+	    while (gcindex < data->narrays) {
+		if (--work < 0) {
+		    return FALSE;
+		}
+		arr = data->base.arrays[gcindex++].arr;
+		if (arr != (Array *) NULL) {
+		    gcmark(arr);
+		}
+	    }
+	}
+	gcphase = GC_MARK;
+	/* fall through */
+    case GC_MARK:
+	while (gcsp != 0) {
+	    if (work < 0) {
+		return FALSE;
+	    }
+	    arr = gcstack[--gcsp];
+	    arr->canonicalize();
+	    if (arr->elts != (Value *) NULL) {
+		gcvalues(arr->elts, arr->size);
+	    }
+	    work -= arr->size + 1;
+	}
+	gccursor = data->alist.next;
+	gcphase = GC_SWEEP;
+	/* fall through */
+    case GC_SWEEP:
+	while (gccursor != &data->alist) {
+	    if (--work < 0) {
+		return FALSE;
+	    }
+	    arr = gccursor;
+	    gccursor = arr->next;
+	    if (!gcmarked(arr)) {
+		/* move to garbage list */
+		arr->prev->next = arr->next;
+		arr->next->prev = arr->prev;
+		arr->prev = &gcgarbage;
+		arr->next = gcgarbage.next;
+		arr->next->prev = arr;
+		gcgarbage.next = arr;
+	    }
+	}
+
+	mem = MM->info()->dmemused;
+	gcfree();
+	/* freeing may allocate */
+	gclast = (mem > MM->info()->dmemused) ? mem - MM->info()->dmemused : 0;
+	gcreclaimed += gclast;
+	gccycles++;
+	data->flags |= DATA_COLLECTED;
+	gcend();
+	break;
+    }
+
+    return TRUE;
+}
+
 /*
  * Swap out a portion of the control and dataspace blocks in
- * memory.  Return the number of dataspace blocks swapped out.
+ * memory.  Return the number of dataspace blocks written.
+ * A fragment of 1 swaps out everything.  Otherwise, the least recently
+ * used fragment is swapped out, subject to the memory watermark and the
+ * time budget: below the watermark, only clean dataspaces are swapped out,
+ * and above it, the fragment and the time budget grow with memory usage.
  */
 Sector Dataspace::swapout(unsigned int frag)
 {
-    Sector n, count;
-    Dataspace *data;
+    Sector n, skip, count;
+    Dataspace *data, *prev;
+    bool writes, clean, start;
+    Uint time, budget;
+    unsigned short mtime;
 
     count = 0;
 
     if (frag != 0) {
+	n = ndata / frag;
+	writes = TRUE;
+	budget = 0;
+	time = 0;
+	mtime = 0;
+	if (frag != 1) {
+	    n -= (n > 0);
+	    budget = swaptime;
+	    if (swapmark != 0) {
+		size_t used, ratio;
+
+		used = MM->info()->dmemused;
+		if (used <= swapmark) {
+		    writes = FALSE;
+		} else {
+		    /* memory pressure */
+		    ratio = used / swapmark;
+		    n = (n == 0) ? 1 : (ratio > ndata / n) ? ndata : n * ratio;
+		    budget *= ratio;
+		}
+	    }
+	    if (budget != 0) {
+		time = P_mtime(&mtime);
+	    }
+	}
+
 	/* swap out dataspace blocks */
 	data = dtail;
-	for (n = ndata / frag, n -= (n > 0 && frag != 1); n > 0; --n) {
-	    Dataspace *prev;
-
+	skip = n;
+	while (n > 0 && data != (Dataspace *) NULL) {
 	    prev = data->prev;
-	    if (data->save(TRUE)) {
-		count++;
+	    clean = !data->dirty();
+	    if (!clean) {
+		if (!writes) {
+		    /* leave it in memory */
+		    if (--skip == 0) {
+			break;
+		    }
+		    data = prev;
+		    continue;
+		}
+		if (data->save(TRUE)) {
+		    count++;
+		}
+		swdirty++;
+	    } else {
+		swclean++;
 	    }
 	    OBJ(data->oindex)->data = (Dataspace *) NULL;
 	    delete data;
 	    data = prev;
+	    --n;
+
+	    if (budget != 0 && n != 0 && (!clean || (swclean & 0x1f) == 0)) {
+		Uint t;
+		unsigned short m;
+
+		t = P_mtime(&m);
+		if ((t - time) * 1000 + m - mtime >= budget) {
+		    /* out of time */
+		    swcut++;
+		    break;
+		}
+	    }
 	}
 
 	Control::swapout(frag);
     }
 
     /* perform garbage collection for one dataspace */
-    if (gcdata != (Dataspace *) NULL) {
-	if (gcdata->save(frag != 0) && frag != 0) {
+    start = FALSE;
+    data = gcdata;
+    if (data != (Dataspace *) NULL) {
+	gcdata = data->gcnext;
+	if (data == gctarget || (data->flags & DATA_COLLECTED)) {
+	    /* being collected, or unchanged since */
+	} else if (data->collectable()) {
+	    if (gcphase == GC_IDLE) {
+		/* start incremental collection */
+		gctarget = data;
+		gcindex = 0;
+		gcphase = GC_VARS;
+		start = TRUE;
+	    }
+	} else if (data->save(frag != 0) && frag != 0) {
+	    count++;
+	}
+    }
+    if (gcphase != GC_IDLE && collect(GCWORK) && start) {
+	/* small enough to be saved as well */
+	if (data->save(frag != 0) && frag != 0) {
 	    count++;
 	}
-	gcdata = gcdata->gcnext;
     }
 
     return count;
 }
 
+/*
+ * return garbage collection statistics
+ */
+void Dataspace::gcInfo(size_t *cycles, size_t *aborts, size_t *reclaimed,
+		       size_t *last)
+{
+    *cycles = gccycles;
+    *aborts = gcaborts;
+    *reclaimed = gcreclaimed;
+    *last = gclast;
+}
+
+/*
+ * return swapout statistics
+ */
+void Dataspace::swapInfo(size_t *clean, size_t *dirty, size_t *cut)
+{
+    *clean = swclean;
+    *dirty = swdirty;
+    *cut = swcut;
+}
+
 /*
  * upgrade all obj and all objects cloned from obj that have
  * dataspaces in memory
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2025 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -164,10 +164,14 @@ public:
     static void wipeExtra(Dataspace *data);
     static Object *upgradeLWO(LWO *lwobj, Object *obj);
     static void xport();
-    static void init();
-    static void initConv(bool c14, bool c16, bool c17, bool cfloat);
+    static void init(Uint time, size_t watermark);
+    static void initConv(bool c14, bool c16, bool c17, bool c20,
+			 bool cfloat);
     static void converted();
     static Sector swapout(unsigned int frag);
+    static void swapInfo(size_t *clean, size_t *dirty, size_t *cut);
+    static void gcInfo(size_t *cycles, size_t *aborts, size_t *reclaimed,
+		       size_t *last);
     static void upgradeMemory(Object *tmpl, Object *newob);
     static void restoreObject(Object *obj, Uint instance, Uint *counttab,
 			      bool cactive, bool dactive);
@@ -200,6 +204,8 @@ private:
     virtual ~Dataspace();
 
     void freeValues();
+    bool dirty();
+    bool collectable();
 # ifdef LARGENUM
     void expand();
 # endif
@@ -213,14 +219,15 @@ private:
     void loadElts(void (*readv) (char*, Sector*, Uint, Uint));
     void loadCallouts(void (*readv) (char*, Sector*, Uint, Uint));
     void loadCallouts();
-    void saveValues(struct SValue *sv, Value *v, unsigned short n);
+    void saveValues(struct SValue *sv, Value *v, ssizet n);
     bool save(bool swap);
     void fix(Uint *counttab);
     void refRhs(Value *rhs);
     void delLhs(Value *lhs);
     void upgradeClone();
-    void import(struct ArrImport *imp, Value *val, unsigned short n);
+    void import(struct ArrImport *imp, Value *val, ssizet n);
 
+    static bool collect(long work);
     static Dataspace *load(Object *obj,
 			   void (*readv) (char*, Sector*, Uint, Uint));
     static Uint convSArray0(struct SArray *sa, Sector *s, Uint n, Uint offset,
@@ -273,6 +280,7 @@ private:
 /* bit values for dataspace->flags */
 # define DATA_STRCMP		0x03	/* strings compressed */
 # define DATA_SUMMAND		0x04	/* callout summand */
+# define DATA_COLLECTED		0x08	/* collected, unchanged since */
 
 /* bit values for dataspace->plane->flags */
 # define MOD_ALL		0x3f
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -84,6 +84,7 @@ void DGD::endTask()
     EC->clearException();
 
     CallOut::swapcount(Dataspace::swapout(fragment));
+    String::endTask();
 
     if (stop) {
 	Comm::clear();
@@ -108,15 +109,15 @@ void DGD::endTask()
 	/*
 	 * create a snapshot
 	 */
-	Config::dump(incr, boot);
-	dump = FALSE;
-	if (!incr) {
+	if (Config::dump(incr, boot, !stop)) {
 	    rebuild = TRUE;
 	    dindex = UINDEX_MAX;
 	}
+	dump = FALSE;
     }
 
     if (stop) {
+	Config::dumped(TRUE);
 	Swap::finish();
 	Config::modFinish(TRUE);
 	Ext::finish();
@@ -157,6 +158,7 @@ int DGD::main(int argc, char **argv)
     char *program;
     Uint rtime, timeout;
     unsigned short rmtime, mtime;
+    int status;
 
     rmtime = 0;
 
@@ -194,6 +196,24 @@ int DGD::main(int argc, char **argv)
 	    }
 	}
 
+	/* background snapshot */
+	if ((status = Config::dumped(FALSE)) >= 0) {
+	    if (!rebuild) {
+		rtime = 0;
+	    }
+	    try {
+		EC->push((ErrorContext::Handler) errHandler);
+		PUSH_INTVAL(cframe, status);
+		callDriver(cframe, "snapshot_done", 1);
+		(cframe->sp++)->del();
+		EC->pop();
+	    } catch (const char*) { }
+	    endTask();
+	} else if (Config::dumping() && !rebuild) {
+	    /* check for completion at least once a second */
+	    rtime = CallOut::cotime(&rmtime) + 1;
+	}
+
 	/* interrupts */
 	if (intr) {
 	    intr = FALSE;
@@ -536,7 +536,7 @@ static Value *ext_mapping_enum(Mapping *m, unsigned int i)
  */
 static int ext_mapping_size(Mapping *m)
 {
-    return m->msize(m->primary->data);
+    return m->count(m->primary->data);
 }
 
 /*
@@ -1056,7 +1056,7 @@ static void ext_vm_stores_cast(Frame *f, uint8_t type,
 			       uint16_t inherit, uint16_t index)
 {
     try {
-	if (f->nStores <= f->sp->array->size) {
+	if (f->nStores <= (int) f->sp->array->size) {
 	    f->cast(&f->sp->array->elts[f->nStores - 1], type,
 		    ((Uint) inherit << 16) + index);
 	}
@@ -1070,7 +1070,7 @@ static void ext_vm_stores_cast(Frame *f, uint8_t type,
  */
 static void ext_vm_stores_param(Frame *f, uint8_t param)
 {
-    if (--(f->nStores) < f->sp->array->size) {
+    if (--(f->nStores) < (int) f->sp->array->size) {
 	f->storeParam(param, &f->sp->array->elts[f->nStores]);
     }
 }
@@ -1080,7 +1080,7 @@ static void ext_vm_stores_param(Frame *f, uint8_t param)
  */
 static LPCint ext_vm_stores_param_int(Frame *f, uint8_t param)
 {
-    if (--(f->nStores) < f->sp->array->size) {
+    if (--(f->nStores) < (int) f->sp->array->size) {
 	f->storeParam(param, &f->sp->array->elts[f->nStores]);
     }
     return f->argp[param].number;
@@ -1092,7 +1092,7 @@ static LPCint ext_vm_stores_param_int(Frame *f, uint8_t param)
  */
 static double ext_vm_stores_param_float(Frame *f, uint8_t param)
 {
-    if (--(f->nStores) < f->sp->array->size) {
+    if (--(f->nStores) < (int) f->sp->array->size) {
 	f->storeParam(param, &f->sp->array->elts[f->nStores]);
     }
     return ext_float_getval(f->argp + param);
@@ -1104,7 +1104,7 @@ static double ext_vm_stores_param_float(Frame *f, uint8_t param)
  */
 static void ext_vm_stores_local(Frame *f, uint8_t local)
 {
-    if (--(f->nStores) < f->sp->array->size) {
+    if (--(f->nStores) < (int) f->sp->array->size) {
 	f->storeLocal(local, &f->sp->array->elts[f->nStores]);
     }
 }
@@ -1114,7 +1114,7 @@ static void ext_vm_stores_local(Frame *f, uint8_t local)
  */
 static LPCint ext_vm_stores_local_int(Frame *f, uint8_t local, LPCint n)
 {
-    if (--(f->nStores) < f->sp->array->size) {
+    if (--(f->nStores) < (int) f->sp->array->size) {
 	f->storeLocal(local, &f->sp->array->elts[f->nStores]);
 	return (f->fp - local)->number;
     }
@@ -1127,7 +1127,7 @@ static LPCint ext_vm_stores_local_int(Frame *f, uint8_t local, LPCint n)
  */
 static double ext_vm_stores_local_float(Frame *f, uint8_t local, double flt)
 {
-    if (--(f->nStores) < f->sp->array->size) {
+    if (--(f->nStores) < (int) f->sp->array->size) {
 	f->storeLocal(local, &f->sp->array->elts[f->nStores]);
 	return ext_float_getval(f->fp - local);
     }
@@ -1140,7 +1140,7 @@ static double ext_vm_stores_local_float(Frame *f, uint8_t local, double flt)
  */
 static void ext_vm_stores_global(Frame *f, uint16_t inherit, uint8_t index)
 {
-    if (--(f->nStores) < f->sp->array->size) {
+    if (--(f->nStores) < (int) f->sp->array->size) {
 	f->storeGlobal(inherit, index, &f->sp->array->elts[f->nStores]);
     }
 }
@@ -1151,7 +1151,7 @@ static void ext_vm_stores_global(Frame *f, uint16_t inherit, uint8_t index)
 static void ext_vm_stores_index(Frame *f)
 {
     try {
-	if (--(f->nStores) < f->sp->array->size) {
+	if (--(f->nStores) < (int) f->sp->array->size) {
 	    f->storeIndex(&f->sp->array->elts[f->nStores]);
 	} else {
 	    f->storeSkip();
@@ -1167,7 +1167,7 @@ static void ext_vm_stores_index(Frame *f)
 static void ext_vm_stores_param_index(Frame *f, uint8_t param)
 {
     try {
-	if (--(f->nStores) < f->sp->array->size) {
+	if (--(f->nStores) < (int) f->sp->array->size) {
 	    f->storeParamIndex(param, &f->sp->array->elts[f->nStores]);
 	} else {
 	    f->storeSkip();
@@ -1183,7 +1183,7 @@ static void ext_vm_stores_param_index(Frame *f, uint8_t param)
 static void ext_vm_stores_local_index(Frame *f, uint8_t local)
 {
     try {
-	if (--(f->nStores) < f->sp->array->size) {
+	if (--(f->nStores) < (int) f->sp->array->size) {
 	    f->storeLocalIndex(local, &f->sp->array->elts[f->nStores]);
 	} else {
 	    f->storeSkip();
@@ -1200,7 +1200,7 @@ static void ext_vm_stores_global_index(Frame *f, uint16_t inherit,
 				       uint8_t index)
 {
     try {
-	if (--(f->nStores) < f->sp->array->size) {
+	if (--(f->nStores) < (int) f->sp->array->size) {
 	    f->storeGlobalIndex(inherit, index,
 				&f->sp->array->elts[f->nStores]);
 	} else {
@@ -1217,7 +1217,7 @@ static void ext_vm_stores_global_index(Frame *f, uint16_t inherit,
 static void ext_vm_stores_index_index(Frame *f)
 {
     try {
-	if (--(f->nStores) < f->sp->array->size) {
+	if (--(f->nStores) < (int) f->sp->array->size) {
 	    f->storeIndexIndex(&f->sp->array->elts[f->nStores]);
 	} else {
 	    f->storeSkipSkip();
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -39,12 +39,18 @@ public:
 	    size(size), maxlen(maxlen), mem(mem) {
 	    table = ALLOC(Entry*, size);
 	    memset(table, '\0', size * sizeof(Entry*));
+	    old = (Entry **) NULL;
+	    osize = migrate = 0;
+	    maxsize = size * HASHGROWMAX;
 	}
 
 	/*
 	 * delete a hash table
 	 */
 	virtual ~Hashtab() {
+	    if (old != (Entry **) NULL) {
+		FREE(old);
+	    }
 	    FREE(table);
 	}
 
@@ -54,49 +60,127 @@ public:
 	 */
 	Entry **lookup(const char *name, bool move) {
 	    Entry **first, **e, *next;
+	    uint64_t hash;
+	    Uint len;
 
-	    if (mem) {
-		first = e = &(table[HM->hashmem(name, maxlen) % size]);
-		while (*e != (Entry *) NULL) {
-		    if (memcmp((*e)->name, name, maxlen) == 0) {
-			if (move && e != first) {
-			    /* move to first position */
-			    next = (*e)->next;
-			    (*e)->next = *first;
-			    *first = *e;
-			    *e = next;
-			    return first;
-			}
-			break;
-		    }
-		    e = &((*e)->next);
-		}
+	    if (old != (Entry **) NULL) {
+		rehash(HASHMIGRATE);
+	    }
+	    hash = (mem) ? HM->hashmem64(name, maxlen) :
+			   HM->hashstr64(name, maxlen);
+	    if (old != (Entry **) NULL && hash % osize >= migrate) {
+		first = e = &old[hash % osize];
 	    } else {
-		first = e = &(table[HM->hashstr(name, maxlen) % size]);
-		while (*e != (Entry *) NULL) {
-		    if (strcmp((*e)->name, name) == 0) {
-			if (move && e != first) {
-			    /* move to first position */
-			    next = (*e)->next;
-			    (*e)->next = *first;
-			    *first = *e;
-			    *e = next;
-			    return first;
-			}
-			break;
+		first = e = &table[hash % size];
+	    }
+
+	    len = 0;
+	    while (*e != (Entry *) NULL) {
+		if ((mem) ? memcmp((*e)->name, name, maxlen) == 0 :
+			    strcmp((*e)->name, name) == 0) {
+		    if (move && e != first) {
+			/* move to first position */
+			next = (*e)->next;
+			(*e)->next = *first;
+			*first = *e;
+			*e = next;
+			return first;
 		    }
-		    e = &((*e)->next);
+		    return e;
 		}
+		e = &((*e)->next);
+		len++;
+	    }
+	    if (len >= HASHGROWLEN && old == (Entry **) NULL &&
+		size < maxsize && distinct(*first) >= HASHGROWLEN) {
+		grow();
 	    }
 	    return e;
 	}
 
+	/*
+	 * complete a pending resize, making all entries reachable from table
+	 */
+	void settle() {
+	    if (old != (Entry **) NULL) {
+		rehash(osize);
+	    }
+	}
+
 	Uint size;		/* size of hash table */
 	Entry **table;		/* hash table entries */
 
     private:
+	/*
+	 * count the entries in a chain, not counting adjacent duplicates
+	 */
+	Uint distinct(Entry *e) {
+	    Uint n;
+
+	    for (n = 1; e->next != (Entry *) NULL; e = e->next) {
+		if ((mem) ? memcmp(e->name, e->next->name, maxlen) != 0 :
+			    strcmp(e->name, e->next->name) != 0) {
+		    n++;
+		}
+	    }
+	    return n;
+	}
+
+	/*
+	 * start doubling the table; entries are moved by later lookups,
+	 * so the address just found remains valid.  The new table may
+	 * outlive the current task, and is therefore static.
+	 */
+	void grow() {
+	    old = table;
+	    osize = size;
+	    migrate = 0;
+	    size <<= 1;
+	    MM->staticMode();
+	    table = ALLOC(Entry*, size);
+	    MM->dynamicMode();
+	    memset(table, '\0', size * sizeof(Entry*));
+	}
+
+	/*
+	 * move up to n buckets from the old table to the new one, keeping
+	 * the order of entries within each chain
+	 */
+	void rehash(Uint n) {
+	    Entry *e, *next, **lo, **hi;
+	    uint64_t hash;
+
+	    while (n != 0 && migrate < osize) {
+		lo = &table[migrate];
+		hi = &table[migrate + osize];
+		for (e = old[migrate]; e != (Entry *) NULL; e = next) {
+		    next = e->next;
+		    hash = (mem) ? HM->hashmem64(e->name, maxlen) :
+				   HM->hashstr64(e->name, maxlen);
+		    if (hash % size == migrate) {
+			*lo = e;
+			lo = &e->next;
+		    } else {
+			*hi = e;
+			hi = &e->next;
+		    }
+		}
+		*lo = *hi = (Entry *) NULL;
+		old[migrate++] = (Entry *) NULL;
+		--n;
+	    }
+	    if (migrate == osize) {
+		FREE(old);
+		old = (Entry **) NULL;
+	    }
+	}
+
 	unsigned short maxlen;	/* max length of string to be used in hashing */
 	bool mem;		/* \0-terminated string or raw memory? */
+	Entry **old;		/* table being rehashed, if any */
+	Uint osize;		/* size of old table */
+	Uint migrate;		/* # old buckets rehashed so far */
+	Uint maxsize;		/* max. size the table may grow to */
     };
 
     /*
@@ -139,6 +223,54 @@ public:
 	}
 	return (unsigned short) ((h << 8) | l);
     }
+
+    /*
+     * hash string, 64 bits at a time
+     */
+    virtual uint64_t hashstr64(const char *str, unsigned int len) {
+	return hashmem64(str, strnlen(str, len));
+    }
+
+    /*
+     * hash memory, 64 bits at a time
+     */
+    virtual uint64_t hashmem64(const char *mem, unsigned int len) {
+	uint64_t h, w;
+
+	h = len * 0x9e3779b97f4a7c15ULL;
+	while (len >= 8) {
+	    memcpy(&w, mem, 8);
+	    h = mix64(h, w);
+	    mem += 8;
+	    len -= 8;
+	}
+	if (len != 0) {
+	    w = 0;
+	    memcpy(&w, mem, len);
+	    h = mix64(h, w);
+	}
+
+	/* final avalanche */
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+    }
+
+private:
+    /*
+     * mix a 64 bit word into a hash value
+     */
+    static uint64_t mix64(uint64_t h, uint64_t w) {
+	w *= 0x87c37b91114253d5ULL;
+	w = (w << 31) | (w >> 33);
+	w *= 0x4cf5ad432745937fULL;
+	h ^= w;
+	h = (h << 27) | (h >> 37);
+	return h * 5 + 0x52dce729;
+    }
 };
 
 class HashImpl : public Hash {
@@ -266,6 +266,12 @@ extern void  P_message	(const char*);
 # define P_rmdir	::rmdir
 # define P_chdir	::chdir
 # define P_execv	::execv
+# ifdef POSIX_FADV_WILLNEED
+# define P_prefetch(fd, offset, len)	\
+			posix_fadvise((fd), (offset), (len), POSIX_FADV_WILLNEED)
+# else
+# define P_prefetch(fd, offset, len)
+# endif
 # else
 	/* filename translation */
 typedef long off_t;
@@ -285,6 +291,7 @@ extern int P_mkdir	(const char*, int);
 extern int P_rmdir	(const char*);
 extern int P_chdir	(const char*);
 extern int P_execv	(const char*, char**);
+extern void P_prefetch	(int, off_t, off_t);
 # endif
 # endif /* INCLUDE_FILE_IO */
 
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -25,6 +25,10 @@
 # include <signal.h>
 # include <pthread.h>
 # include <errno.h>
+# ifdef EPOLL
+# include <sys/epoll.h>
+# include <sys/resource.h>
+# endif
 # define INCLUDE_FILE_IO
 # include "dgd.h"
 # include "hash.h"
@@ -432,6 +436,7 @@ public:
     virtual void stop();
     virtual bool udpCheck();
     virtual int read(char *buf, unsigned int len);
+    virtual bool readable();
     virtual int readUdp(char *buf, unsigned int len);
     virtual int write(char *buf, unsigned int len);
     virtual int writeUdp(char *buf, unsigned int len);
@@ -485,6 +490,28 @@ public:
     char buffer[BINBUF_SIZE];		/* buffer */
 };
 
+struct UdpMsg {
+    union {
+# ifdef INET6
+	struct sockaddr_in6 sin6;	/* IPv6 destination */
+# endif
+	struct sockaddr_in sin;		/* IPv4 destination */
+    } to;
+    socklen_t tolen;			/* size of destination */
+    int fd;				/* port descriptor */
+    char *buf;				/* datagram */
+    unsigned int len;			/* datagram length */
+};
+
+# define UDPQ_SIZE	64		/* max # queued datagrams */
+# define UDPQ_BUFSZ	65536		/* size of datagram queue buffer */
+
+static UdpMsg *udpq;			/* queued outbound datagrams */
+static char *udpqbuf;			/* queued datagram buffer */
+static int nudpq;			/* # queued datagrams */
+static unsigned int udpqlen;		/* # bytes in datagram queue buffer */
+static int udpcalls;			/* # sends not reported yet */
+static int udpfailed;			/* # failures not reported yet */
 static Hash::Entry **udphtab;		/* UDP hash table */
 static int udphtabsz;			/* UDP hash table size */
 static Hash::Hashtab *chtab;		/* challenge hash table */
@@ -698,6 +725,47 @@ extern "C" {
  */
 static void *udp_run(void *arg)
 {
+# ifdef EPOLL
+    struct epoll_event event, events[16];
+    int udpfd, n, retval;
+
+    if ((udpfd=epoll_create1(EPOLL_CLOEXEC)) < 0) {
+	perror("epoll_create1");
+	return (void *) NULL;
+    }
+    for (n = 0; n < nudescs; n++) {
+	event.events = EPOLLIN;
+# ifdef INET6
+	if (udescs[n].fd.in6 >= 0) {
+	    event.data.u32 = (n << 1) | 1;
+	    epoll_ctl(udpfd, EPOLL_CTL_ADD, udescs[n].fd.in6, &event);
+	}
+# endif
+	if (udescs[n].fd.in4 >= 0) {
+	    event.data.u32 = n << 1;
+	    epoll_ctl(udpfd, EPOLL_CTL_ADD, udescs[n].fd.in4, &event);
+	}
+    }
+
+    for (;;) {
+	retval = epoll_wait(udpfd, events, 16, -1);
+	if (udpstop) {
+	    break;
+	}
+
+	for (n = 0; n < retval; n++) {
+# ifdef INET6
+	    if (events[n].data.u32 & 1) {
+		Udp::recv6(events[n].data.u32 >> 1);
+		continue;
+	    }
+# endif
+	    Udp::recv(events[n].data.u32 >> 1);
+	}
+    }
+
+    close(udpfd);
+# else
     fd_set udpfds;
     fd_set readfds;
     fd_set errorfds;
@@ -746,6 +814,7 @@ static void *udp_run(void *arg)
 	    }
 	}
     }
+# endif
 
     pthread_mutex_destroy(&udpmutex);
     close(inpkts);
@@ -760,13 +829,164 @@ static XConnection **connections;	/* connections array */
 static Hash::Entry *flist;		/* list of free connections */
 static PortDesc *tdescs, *bdescs;	/* telnet & binary descriptor arrays */
 static int ntdescs, nbdescs;		/* # telnet & binary ports */
+static int maxfd;			/* largest fd opened yet */
+static int closed;			/* #fds closed in write */
+
+# define FDS_IN		0x01	/* check for input */
+# define FDS_OUT	0x02	/* check for output */
+# define FDS_WAIT	0x04	/* waiting for output */
+# define FDS_READ	0x08	/* ready for reading */
+# define FDS_WRITE	0x10	/* ready for writing */
+# define FDS_LEVEL	0x20	/* level-triggered */
+
+# ifdef EPOLL
+# define EPOLL_MAXFD	1048576	/* max # file descriptors tracked */
+
+static int epfd = -1;			/* epoll descriptor */
+static struct epoll_event *events;	/* epoll event buffer */
+static int nevents;			/* size of event buffer */
+static unsigned char *fdstate;		/* state per file descriptor */
+static int fdsize;			/* # file descriptor states */
+static int nready;			/* # descriptors with pending input */
+
+/*
+ * (re)register a file descriptor with epoll
+ */
+static void fdpoll(int fd, int old)
+{
+    struct epoll_event event;
+    int state;
+
+    state = fdstate[fd];
+    if ((old ^ state) & (FDS_IN | FDS_OUT)) {
+	if (!(state & (FDS_IN | FDS_OUT))) {
+	    /* no longer polled: forget all state */
+	    epoll_ctl(epfd, EPOLL_CTL_DEL, fd, &event);
+	    fdstate[fd] = state = 0;
+	} else {
+	    event.events = ((state & FDS_IN) ? EPOLLIN : 0) |
+			   ((state & FDS_OUT) ? EPOLLOUT : 0) |
+			   ((state & FDS_LEVEL) ? 0 : EPOLLET);
+	    event.data.fd = fd;
+	    epoll_ctl(epfd,
+		      (old & (FDS_IN | FDS_OUT)) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD,
+		      fd, &event);
+	}
+    }
+    old = ((old & (FDS_IN | FDS_READ)) == (FDS_IN | FDS_READ));
+    state = ((state & (FDS_IN | FDS_READ)) == (FDS_IN | FDS_READ));
+    nready += state - old;
+}
+
+/*
+ * set file descriptor state
+ */
+static void fdset(int fd, int flags)
+{
+    int old;
+
+    if (fd >= fdsize) {
+	EC->fatal("file descriptor %d out of range", fd);
+    }
+    old = fdstate[fd];
+    fdstate[fd] |= flags;
+    fdpoll(fd, old);
+}
+
+/*
+ * clear file descriptor state
+ */
+static void fdclr(int fd, int flags)
+{
+    int old;
+
+    old = fdstate[fd];
+    fdstate[fd] &= ~flags;
+    fdpoll(fd, old);
+}
+
+/*
+ * check file descriptor state
+ */
+static bool fdisset(int fd, int flag)
+{
+    return ((fdstate[fd] & flag) != 0);
+}
+# else
 static fd_set infds;			/* file descriptor input bitmap */
 static fd_set outfds;			/* file descriptor output bitmap */
 static fd_set waitfds;			/* file descriptor wait-write bitmap */
 static fd_set readfds;			/* file descriptor read bitmap */
 static fd_set writefds;			/* file descriptor write map */
-static int maxfd;			/* largest fd opened yet */
-static int closed;			/* #fds closed in write */
+
+/*
+ * set file descriptor state
+ */
+static void fdset(int fd, int flags)
+{
+    if (flags & FDS_IN) {
+	FD_SET(fd, &infds);
+    }
+    if (flags & FDS_OUT) {
+	FD_SET(fd, &outfds);
+    }
+    if (flags & FDS_WAIT) {
+	FD_SET(fd, &waitfds);
+    }
+    if (flags & FDS_READ) {
+	FD_SET(fd, &readfds);
+    }
+    if (flags & FDS_WRITE) {
+	FD_SET(fd, &writefds);
+    }
+}
+
+/*
+ * clear file descriptor state
+ */
+static void fdclr(int fd, int flags)
+{
+    if (flags & FDS_IN) {
+	FD_CLR(fd, &infds);
+    }
+    if (flags & FDS_OUT) {
+	FD_CLR(fd, &outfds);
+    }
+    if (flags & FDS_WAIT) {
+	FD_CLR(fd, &waitfds);
+    }
+    if (flags & FDS_READ) {
+	FD_CLR(fd, &readfds);
+    }
+    if (flags & FDS_WRITE) {
+	FD_CLR(fd, &writefds);
+    }
+}
+
+/*
+ * check file descriptor state
+ */
+static bool fdisset(int fd, int flag)
+{
+    switch (flag) {
+    case FDS_IN:
+	return FD_ISSET(fd, &infds);
+
+    case FDS_OUT:
+	return FD_ISSET(fd, &outfds);
+
+    case FDS_WAIT:
+	return FD_ISSET(fd, &waitfds);
+
+    case FDS_READ:
+	return FD_ISSET(fd, &readfds);
+
+    case FDS_WRITE:
+	return FD_ISSET(fd, &writefds);
+    }
+    return FALSE;
+}
+# endif
 
 # ifdef INET6
 /*
@@ -812,7 +1032,7 @@ int XConnection::port6(int *fd, int type, struct sockaddr_in6 *sin6,
 	if (*fd > maxfd) {
 	    maxfd = *fd;
 	}
-	FD_SET(*fd, &infds);
+	fdset(*fd, FDS_IN);
     }
     return TRUE;
 }
@@ -854,7 +1074,7 @@ int XConnection::port4(int *fd, int type, struct sockaddr_in *sin,
 	if (*fd > maxfd) {
 	    maxfd = *fd;
 	}
-	FD_SET(*fd, &infds);
+	fdset(*fd, FDS_IN);
     }
     return TRUE;
 }
@@ -888,16 +1108,38 @@ bool Connection::init(int maxusers, char **thosts, char **bhosts, char **dhosts,
     nusers = 0;
 
     maxfd = 0;
+# ifdef EPOLL
+    {
+	struct rlimit rlim;
+
+	if ((epfd=epoll_create1(EPOLL_CLOEXEC)) < 0) {
+	    perror("epoll_create1");
+	    return FALSE;
+	}
+	if (getrlimit(RLIMIT_NOFILE, &rlim) < 0) {
+	    perror("getrlimit");
+	    return FALSE;
+	}
+	fdsize = (rlim.rlim_cur == RLIM_INFINITY ||
+		  rlim.rlim_cur > EPOLL_MAXFD) ? EPOLL_MAXFD : rlim.rlim_cur;
+	fdstate = ALLOC(unsigned char, fdsize);
+	memset(fdstate, '\0', fdsize);
+	nready = 0;
+	events = ALLOC(struct epoll_event,
+		       nevents = maxusers + 2 * (ntports + nbports) + 2);
+    }
+# else
     FD_ZERO(&infds);
     FD_ZERO(&outfds);
     FD_ZERO(&waitfds);
-    FD_SET(in, &infds);
+# endif
+    fdset(in, FDS_IN | FDS_LEVEL);
     closed = 0;
 
     (void) pipe(fds);
     inpkts = fds[0];
     outpkts = fds[1];
-    FD_SET(inpkts, &infds);
+    fdset(inpkts, FDS_IN | FDS_LEVEL);
     if (inpkts > maxfd) {
 	maxfd = inpkts;
     }
@@ -916,7 +1158,12 @@ bool Connection::init(int maxusers, char **thosts, char **bhosts, char **dhosts,
     if (ndports != 0) {
 	udescs = ALLOC(Udp, ndports);
 	memset(udescs, -1, ndports * sizeof(Udp));
+	udpq = ALLOC(UdpMsg, UDPQ_SIZE);
+	udpqbuf = ALLOC(char, UDPQ_BUFSZ);
     }
+    nudpq = 0;
+    udpqlen = 0;
+    udpcalls = udpfailed = 0;
 
 # ifdef INET6
     memset(&sin6, '\0', sizeof(sin6));
@@ -1216,8 +1463,8 @@ void Connection::listen()
 	if (tdescs[n].in4 >= 0) {
 	    if (::listen(tdescs[n].in4, 64) < 0) {
 # ifdef INET6
+		fdclr(tdescs[n].in4, FDS_IN);
 		close(tdescs[n].in4);
-		FD_CLR(tdescs[n].in4, &infds);
 		tdescs[n].in4 = -1;
 		continue;
 # else
@@ -1247,8 +1494,8 @@ void Connection::listen()
 	if (bdescs[n].in4 >= 0) {
 	    if (::listen(bdescs[n].in4, 64) < 0) {
 # ifdef INET6
+		fdclr(bdescs[n].in4, FDS_IN);
 		close(bdescs[n].in4);
-		FD_CLR(bdescs[n].in4, &infds);
 		bdescs[n].in4 = -1;
 		continue;
 # else
@@ -1276,13 +1523,13 @@ XConnection *XConnection::create6(int portfd, int port)
     In46Addr addr;
     XConnection *conn;
 
-    if (!FD_ISSET(portfd, &readfds)) {
+    if (!fdisset(portfd, FDS_READ)) {
 	return (XConnection *) NULL;
     }
     len = sizeof(sin6);
     fd = accept(portfd, (struct sockaddr *) &sin6, &len);
     if (fd < 0) {
-	FD_CLR(portfd, &readfds);
+	fdclr(portfd, FDS_READ);
 	return (XConnection *) NULL;
     }
     fcntl(fd, F_SETFL, FNDELAY);
@@ -1302,10 +1549,8 @@ XConnection *XConnection::create6(int portfd, int port)
     }
     conn->addr = IpAddr::create(&addr);
     conn->at = port;
-    FD_SET(fd, &infds);
-    FD_SET(fd, &outfds);
-    FD_CLR(fd, &readfds);
-    FD_SET(fd, &writefds);
+    fdclr(fd, FDS_READ);
+    fdset(fd, FDS_IN | FDS_OUT | FDS_WRITE);
     if (fd > maxfd) {
 	maxfd = fd;
     }
@@ -1325,13 +1570,13 @@ XConnection *XConnection::create(int portfd, int port)
     In46Addr addr;
     XConnection *conn;
 
-    if (!FD_ISSET(portfd, &readfds)) {
+    if (!fdisset(portfd, FDS_READ)) {
 	return (XConnection *) NULL;
     }
     len = sizeof(sin);
     fd = accept(portfd, (struct sockaddr *) &sin, &len);
     if (fd < 0) {
-	FD_CLR(portfd, &readfds);
+	fdclr(portfd, FDS_READ);
 	return (XConnection *) NULL;
     }
     fcntl(fd, F_SETFL, FNDELAY);
@@ -1345,10 +1590,8 @@ XConnection *XConnection::create(int portfd, int port)
     addr.ipv6 = FALSE;
     conn->addr = IpAddr::create(&addr);
     conn->at = port;
-    FD_SET(fd, &infds);
-    FD_SET(fd, &outfds);
-    FD_CLR(fd, &readfds);
-    FD_SET(fd, &writefds);
+    fdclr(fd, FDS_READ);
+    fdset(fd, FDS_IN | FDS_OUT | FDS_WRITE);
     if (fd > maxfd) {
 	maxfd = fd;
     }
@@ -1532,10 +1775,8 @@ void XConnection::del()
     Hash::Entry **hash;
 
     if (fd >= 0) {
+	fdclr(fd, FDS_IN | FDS_OUT | FDS_WAIT);
 	close(fd);
-	FD_CLR(fd, &infds);
-	FD_CLR(fd, &outfds);
-	FD_CLR(fd, &waitfds);
 	fd = -1;
     } else if (fd == -1) {
 	--closed;
@@ -1579,10 +1820,9 @@ void XConnection::block(int flag)
 {
     if (fd >= 0) {
 	if (flag) {
-	    FD_CLR(fd, &infds);
-	    FD_CLR(fd, &readfds);
+	    fdclr(fd, FDS_IN | FDS_READ);
 	} else {
-	    FD_SET(fd, &infds);
+	    fdset(fd, FDS_IN);
 	}
     }
 }
@@ -1602,6 +1842,65 @@ void XConnection::stop()
  */
 int Connection::select(Uint t, unsigned int mtime)
 {
+# ifdef EPOLL
+    int retval, pending, timeout, n, fd;
+
+    /*
+     * Descriptors are registered edge-triggered, and remain ready until a
+     * read or write would block.  Only wait if nothing is pending.
+     */
+    fdclr(in, FDS_READ);
+    fdclr(inpkts, FDS_READ);
+    pending = nready;
+    if (flist == (Hash::Entry *) NULL) {
+	/* can't accept new connections, so don't check for them */
+	for (n = ntdescs; n != 0; ) {
+	    --n;
+	    if (tdescs[n].in6 >= 0 && fdisset(tdescs[n].in6, FDS_READ)) {
+		--pending;
+	    }
+	    if (tdescs[n].in4 >= 0 && fdisset(tdescs[n].in4, FDS_READ)) {
+		--pending;
+	    }
+	}
+	for (n = nbdescs; n != 0; ) {
+	    --n;
+	    if (bdescs[n].in6 >= 0 && fdisset(bdescs[n].in6, FDS_READ)) {
+		--pending;
+	    }
+	    if (bdescs[n].in4 >= 0 && fdisset(bdescs[n].in4, FDS_READ)) {
+		--pending;
+	    }
+	}
+    }
+    if (closed != 0 || pending != 0) {
+	timeout = 0;
+    } else if (mtime != 0xffff) {
+	timeout = (t > (INT_MAX - 999) / 1000) ? INT_MAX : t * 1000 + mtime;
+    } else {
+	timeout = -1;
+    }
+    retval = epoll_wait(epfd, events, nevents, timeout);
+    if (retval < 0) {
+	retval = 0;
+    }
+    for (n = 0; n < retval; n++) {
+	fd = events[n].data.fd;
+	if (events[n].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+	    fdset(fd, FDS_READ);
+	}
+	if (events[n].events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) {
+	    fdset(fd, FDS_WRITE);
+	}
+    }
+    retval += pending + closed;
+
+    /* handle ip name lookup */
+    if (fdisset(in, FDS_READ)) {
+	IpAddr::lookup();
+    }
+    return retval;
+# else
     struct timeval timeout;
     int retval, n;
 
@@ -1664,6 +1963,7 @@ int Connection::select(Uint t, unsigned int mtime)
 	IpAddr::lookup();
     }
     return retval;
+# endif
 }
 
 /*
@@ -1684,21 +1984,37 @@ int XConnection::read(char *buf, unsigned int len)
     if (fd < 0) {
 	return -1;
     }
-    if (!FD_ISSET(fd, &readfds)) {
+    if (!fdisset(fd, FDS_READ)) {
 	return 0;
     }
     size = ::read(fd, buf, len);
     if (size < 0) {
+# ifdef EPOLL
+	if (errno == EAGAIN || errno == EWOULDBLOCK) {
+	    /* nothing left to read */
+	    fdclr(fd, FDS_READ);
+	    return 0;
+	}
+# endif
+	fdclr(fd, FDS_IN | FDS_OUT | FDS_WAIT);
 	close(fd);
-	FD_CLR(fd, &infds);
-	FD_CLR(fd, &outfds);
-	FD_CLR(fd, &waitfds);
 	fd = -1;
 	closed++;
+    } else if (size != 0 && (unsigned int) size < len) {
+	/* input drained */
+	fdclr(fd, FDS_READ);
     }
     return (size == 0) ? -1 : size;
 }
 
+/*
+ * check if input is waiting on a connection
+ */
+bool XConnection::readable()
+{
+    return (fd >= 0 && fdisset(fd, FDS_READ));
+}
+
 /*
  * read a message from a UDP channel
  */
@@ -1742,21 +2058,20 @@ int XConnection::write(char *buf, unsigned int len)
     if (len == 0) {
 	return 0;
     }
-    if (!FD_ISSET(fd, &writefds)) {
+    if (!fdisset(fd, FDS_WRITE)) {
 	/* the write would fail */
-	FD_SET(fd, &waitfds);
+	fdset(fd, FDS_WAIT);
 	return 0;
     }
     if ((size=::write(fd, buf, len)) < 0 && errno != EWOULDBLOCK) {
+	fdclr(fd, FDS_IN | FDS_OUT);
 	close(fd);
-	FD_CLR(fd, &infds);
-	FD_CLR(fd, &outfds);
 	fd = -1;
 	closed++;
     } else if (size != len) {
 	/* waiting for wrdone */
-	FD_SET(fd, &waitfds);
-	FD_CLR(fd, &writefds);
+	fdset(fd, FDS_WAIT);
+	fdclr(fd, FDS_WRITE);
 	if (size < 0) {
 	    return 0;
 	}
@@ -1769,43 +2084,114 @@ int XConnection::write(char *buf, unsigned int len)
  */
 int XConnection::writeUdp(char *buf, unsigned int len)
 {
-    if (fd != -1) {
+    UdpMsg *msg;
+    int failed;
+
+    if (fd != -1 && len <= UDPQ_BUFSZ) {
+	if (nudpq == UDPQ_SIZE || udpqlen + len > UDPQ_BUFSZ) {
+	    /* make room */
+	    udpcalls += Connection::flushUdp(&failed);
+	    udpfailed += failed;
+	}
+
+	/* queue the datagram */
+	msg = &udpq[nudpq];
+	msg->buf = udpqbuf + udpqlen;
+	msg->len = len;
+	memcpy(msg->buf, buf, len);
 # ifdef INET6
 	if (addr->ipnum.ipv6) {
-	    struct sockaddr_in6 to;
-
-	    memset(&to, '\0', sizeof(struct sockaddr_in6));
-	    to.sin6_family = AF_INET6;
-	    memcpy(&to.sin6_addr, &addr->ipnum.addr6, sizeof(struct in6_addr));
-	    to.sin6_port = port;
-	    return sendto(udescs[at].fd.in6, buf, len, 0,
-			  (struct sockaddr *) &to, sizeof(struct sockaddr_in6));
+	    memset(&msg->to.sin6, '\0', sizeof(struct sockaddr_in6));
+	    msg->to.sin6.sin6_family = AF_INET6;
+	    memcpy(&msg->to.sin6.sin6_addr, &addr->ipnum.addr6,
+		   sizeof(struct in6_addr));
+	    msg->to.sin6.sin6_port = port;
+	    msg->tolen = sizeof(struct sockaddr_in6);
+	    msg->fd = udescs[at].fd.in6;
 	} else
 # endif
 	{
-	    struct sockaddr_in to;
-
-	    memset(&to, '\0', sizeof(struct sockaddr_in));
-	    to.sin_family = AF_INET;
-	    to.sin_addr = addr->ipnum.addr;
-	    to.sin_port = port;
-	    return sendto(udescs[at].fd.in4, buf, len, 0,
-			  (struct sockaddr *) &to, sizeof(struct sockaddr_in));
+	    memset(&msg->to.sin, '\0', sizeof(struct sockaddr_in));
+	    msg->to.sin.sin_family = AF_INET;
+	    msg->to.sin.sin_addr = addr->ipnum.addr;
+	    msg->to.sin.sin_port = port;
+	    msg->tolen = sizeof(struct sockaddr_in);
+	    msg->fd = udescs[at].fd.in4;
 	}
+	nudpq++;
+	udpqlen += len;
+	return len;
     }
     return -1;
 }
 
+/*
+ * send all queued datagrams, return the number of system calls used and
+ * the number of datagrams that could not be sent
+ */
+int Connection::flushUdp(int *failed)
+{
+    UdpMsg *msg;
+    int n, calls;
+# ifdef LINUX
+    struct mmsghdr msgs[UDPQ_SIZE];
+    struct iovec iov[UDPQ_SIZE];
+    int i, sent;
+# endif
+
+    calls = udpcalls;
+    *failed = udpfailed;
+    udpcalls = udpfailed = 0;
+    msg = udpq;
+    n = nudpq;
+# ifdef LINUX
+    while (n != 0) {
+	/* gather datagrams sent from the same port */
+	for (i = 0; i < n && msg[i].fd == msg->fd; i++) {
+	    iov[i].iov_base = msg[i].buf;
+	    iov[i].iov_len = msg[i].len;
+	    memset(&msgs[i].msg_hdr, '\0', sizeof(struct msghdr));
+	    msgs[i].msg_hdr.msg_name = &msg[i].to;
+	    msgs[i].msg_hdr.msg_namelen = msg[i].tolen;
+	    msgs[i].msg_hdr.msg_iov = &iov[i];
+	    msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+	sent = sendmmsg(msg->fd, msgs, i, 0);
+	calls++;
+	if (sent <= 0) {
+	    sent = 1;	/* skip the datagram that failed */
+	    (*failed)++;
+	}
+	msg += sent;
+	n -= sent;
+    }
+# else
+    while (n != 0) {
+	if (sendto(msg->fd, msg->buf, msg->len, 0,
+		   (struct sockaddr *) &msg->to, msg->tolen) < 0) {
+	    (*failed)++;
+	}
+	calls++;
+	msg++;
+	--n;
+    }
+# endif
+    nudpq = 0;
+    udpqlen = 0;
+
+    return calls;
+}
+
 /*
  * return TRUE if a connection is ready for output
  */
 bool XConnection::wrdone()
 {
-    if (fd < 0 || !FD_ISSET(fd, &waitfds)) {
+    if (fd < 0 || !fdisset(fd, FDS_WAIT)) {
 	return TRUE;
     }
-    if (FD_ISSET(fd, &writefds)) {
-	FD_CLR(fd, &waitfds);
+    if (fdisset(fd, FDS_WRITE)) {
+	fdclr(fd, FDS_WAIT);
 	return TRUE;
     }
     return FALSE;
@@ -1965,11 +2351,8 @@ Connection *Connection::connect(void *addr, int len)
 	}
     }
 
-    FD_SET(sock, &infds);
-    FD_SET(sock, &outfds);
-    FD_CLR(sock, &readfds);
-    FD_CLR(sock, &writefds);
-    FD_SET(sock, &waitfds);
+    fdclr(sock, FDS_READ | FDS_WRITE);
+    fdset(sock, FDS_IN | FDS_OUT | FDS_WAIT);
     if (sock > maxfd) {
 	maxfd = sock;
     }
@@ -2109,10 +2492,10 @@ int XConnection::checkConnected(int *errcode)
     if (err != 0) {
 	optval = err;
     } else {
-	if (!FD_ISSET(fd, &writefds)) {
+	if (!fdisset(fd, FDS_WRITE)) {
 	    return 0;
 	}
-	FD_CLR(fd, &waitfds);
+	fdclr(fd, FDS_WAIT);
 
 	/*
 	 * Delayed connect completed, check for errors
@@ -2193,13 +2576,13 @@ bool XConnection::cexport(int *fd, char *addr, unsigned short *port, short *at,
 	*npkts = this->npkts;
 	*bufsz = this->bufsz;
 	*buf = this->udpbuf;
-	if (FD_ISSET(this->fd, &readfds)) {
+	if (fdisset(this->fd, FDS_READ)) {
 	    *flags |= CONN_READF;
 	}
-	if (FD_ISSET(this->fd, &writefds)) {
+	if (fdisset(this->fd, FDS_WRITE)) {
 	    *flags |= CONN_WRITEF;
 	}
-	if (FD_ISSET(this->fd, &waitfds)) {
+	if (fdisset(this->fd, FDS_WAIT)) {
 	    *flags |= CONN_WAITF;
 	}
 	if (udpbuf != (char *) NULL) {
@@ -2253,16 +2636,15 @@ Connection *Connection::import(int fd, char *addr, unsigned short port,
 	    return NULL;
 	}
 
-	FD_SET(fd, &infds);
-	FD_SET(fd, &outfds);
+	fdset(fd, FDS_IN | FDS_OUT);
 	if (flags & CONN_READF) {
-	    FD_SET(fd, &readfds);
+	    fdset(fd, FDS_READ);
 	}
 	if (flags & CONN_WRITEF) {
-	    FD_SET(fd, &writefds);
+	    fdset(fd, FDS_WRITE);
 	}
 	if (flags & CONN_WAITF) {
-	    FD_SET(fd, &waitfds);
+	    fdset(fd, FDS_WAIT);
 	}
 	if (fd > maxfd) {
 	    maxfd = fd;
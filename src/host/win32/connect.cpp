@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -361,6 +361,7 @@ public:
     virtual void stop();
     virtual bool udpCheck();
     virtual int read(char *buf, unsigned int len);
+    virtual bool readable();
     virtual int readUdp(char *buf, unsigned int len);
     virtual int write(char *buf, unsigned int len);
     virtual int writeUdp(char *buf, unsigned int len);
@@ -417,6 +418,7 @@ static int nudescs;			/* # datagram ports */
 static SOCKET inpkts, outpkts;		/* UDP packet notification pip */
 static CRITICAL_SECTION udpmutex;	/* UDP mutex */
 static bool udpstop;			/* stop UDP thread? */
+static int udpcalls;			/* # sends not reported yet */
 
 /*
  * receive an UDP packet
@@ -1573,6 +1575,14 @@ int XConnection::read(char *buf, unsigned int len)
     return (size == 0 || size == SOCKET_ERROR) ? -1 : size;
 }
 
+/*
+ * check if input is waiting on a connection
+ */
+bool XConnection::readable()
+{
+    return (fd != INVALID_SOCKET && FD_ISSET(fd, &readfds));
+}
+
 /*
  * read a message from a UDP channel
  */
@@ -1645,6 +1655,7 @@ int XConnection::write(char *buf, unsigned int len)
 int XConnection::writeUdp(char *buf, unsigned int len)
 {
     if (fd != INVALID_SOCKET || udpFlag) {
+	udpcalls++;
 	if (addr->ipnum.ipv6) {
 	    struct sockaddr_in6 to;
 
@@ -1667,6 +1678,20 @@ int XConnection::writeUdp(char *buf, unsigned int len)
     return -1;
 }
 
+/*
+ * datagrams are sent immediately, return the number of system calls used;
+ * failures are reported by writeUdp()
+ */
+int Connection::flushUdp(int *failed)
+{
+    int calls;
+
+    *failed = 0;
+    calls = udpcalls;
+    udpcalls = 0;
+    return calls;
+}
+
 /*
  * return TRUE if a connection is ready for output
  */
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2020 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -115,6 +115,16 @@ long P_lseek(int fd, long offset, int whence)
     return _lseek(fd, offset, whence);
 }
 
+/*
+ * announce that part of a file will be read soon (not supported)
+ */
+void P_prefetch(int fd, long offset, long len)
+{
+    UNREFERENCED_PARAMETER(fd);
+    UNREFERENCED_PARAMETER(offset);
+    UNREFERENCED_PARAMETER(len);
+}
+
 /*
  * get information about a file
  */
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2025 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -26,6 +26,7 @@
 # include "data.h"
 # include "interpret.h"
 # include "ext.h"
+# include "profile.h"
 # include "table.h"
 
 # ifdef DEBUG
@@ -38,11 +39,24 @@ static Value stack[MIN_STACK];	/* initial stack */
 static Frame topframe;		/* top frame */
 static RLInfo rlim;		/* top rlimits info */
 Frame *cframe;			/* current frame */
+Uint Frame::ticksSpent;		/* total ticks spent */
 static char *creator;		/* creator function name */
 static unsigned int clen;	/* creator function name length */
 static bool stricttc;		/* strict typechecking */
 static char ihash[INHASHSZ];	/* instanceof hashtable */
 
+struct CallCache {
+    uindex oindex;		/* program object */
+    Uint instance;		/* program instance */
+    unsigned short len;		/* function name length */
+    char inherit;		/* function program index */
+    char index;			/* function index */
+    char func[CALLNAMESZ];	/* function name */
+};
+
+static CallCache ccache[CALLCACHESZ];	/* call_other cache */
+static size_t chits, cmisses;	/* call_other cache statistics */
+
 /*
  * initialize the interpreter
  */
@@ -65,6 +79,29 @@ void Frame::init(char *create, bool flag)
     stricttc = flag;
 
     Value::init(stricttc);
+    flushCalls();
+}
+
+/*
+ * invalidate the call_other cache
+ */
+void Frame::flushCalls()
+{
+    CallCache *c;
+    int i;
+
+    for (c = ccache, i = CALLCACHESZ; i != 0; c++, --i) {
+	c->oindex = OBJ_NONE;
+    }
+}
+
+/*
+ * return call_other cache statistics
+ */
+void Frame::callInfo(size_t *hits, size_t *misses)
+{
+    *hits = chits;
+    *misses = cmisses;
 }
 
 /*
@@ -311,7 +348,7 @@ int Frame::spread(int n)
 	return n - 1;
     } else {
 	/* including lvalues */
-	if (n > a->size) {
+	if (n > (int) a->size) {
 	    n = a->size;
 	}
 	addTicks(n);
@@ -602,6 +639,37 @@ void Frame::storeGlobal(int inherit, int index, Value *val)
     }
 }
 
+/*
+ * Add two strings, if the result is about to be stored in the local
+ * variable that holds the only other reference to the first string.  The
+ * first string is then appended to in place.
+ */
+bool Frame::appendLocal(char *pc)
+{
+    unsigned short u;
+    Value *var;
+    String *str;
+
+    if (sp[1].type != T_STRING || sp->type != T_STRING) {
+	return FALSE;
+    }
+    str = sp[1].string;
+    if (str->refCount != 2 || str->primary != (StrRef *) NULL ||
+	(FETCH1U(pc) & I_INSTR_MASK & ~I_POP_BIT) != I_STORE_LOCAL) {
+	return FALSE;
+    }
+    u = FETCH1U(pc);
+    var = (SCHAR(u) >= 0) ? argp + u : fp + SCHAR(u);
+    if (var->type != T_STRING || var->string != str) {
+	return FALSE;
+    }
+
+    addTicks(2);
+    str->append(sp->string);
+    (sp++)->string->del();
+    return TRUE;
+}
+
 /*
  * perform an indexed assignment
  */
@@ -964,12 +1032,12 @@ void Frame::stores(int skip, int assign)
 /*
  * spread lvalues
  */
-unsigned short Frame::storesSpread(int n, int offset, int type, Uint sclass)
+ssizet Frame::storesSpread(int n, int offset, int type, Uint sclass)
 {
-    unsigned short nassign, nspread;
+    ssizet nassign, nspread;
 
     nassign = sp->array->size;
-    if (n < nassign && sp[1].array->size > offset) {
+    if (n < (int) nassign && (int) sp[1].array->size > offset) {
 	nspread = sp[1].array->size - offset;
 	if (nspread >= nassign - n) {
 	    nspread = nassign - n;
@@ -1001,7 +1069,7 @@ void Frame::lvalues(int n)
 {
     char *pc;
     int offset, type;
-    unsigned short nassign;
+    ssizet nassign;
     Uint sclass;
 
     pc = this->pc;
@@ -1025,7 +1093,7 @@ void Frame::lvalues(int n)
 	    nassign = storesSpread(--n, offset, type, sclass);
 	}
 
-	if (n < nassign) {
+	if (n < (int) nassign) {
 	    EC->error("Missing lvalue");
 	}
     }
@@ -1823,6 +1891,42 @@ void Frame::vfunc(int n, int nargs)
     funcall((Object *) NULL, (LWO *) NULL, UCHAR(p[0]), UCHAR(p[1]), nargs);
 }
 
+# ifdef DEBUG
+# define CHECKSTACK()	if (sp < stack + MIN_STACK) {			\
+			    EC->fatal("out of value stack");		\
+			}
+# else
+# define CHECKSTACK()
+# endif
+
+# ifdef __GNUC__
+/*
+ * threaded code: every instruction dispatches the next one through a label
+ * table, and frequent instruction pairs branch to their successor directly
+ */
+# define OP(label)	label:
+# define NEXT		{						\
+			    CHECKSTACK();				\
+			    instr = FETCH1U(pc);			\
+			    this->pc = pc;				\
+			    goto *optab[instr & I_INSTR_MASK];		\
+			}
+# define FUSE(op, label) if ((UCHAR(*pc) & I_INSTR_MASK) == (op)) {	\
+			    CHECKSTACK();				\
+			    instr = FETCH1U(pc);			\
+			    this->pc = pc;				\
+			    goto label;					\
+			}
+# else
+# define OP(label)
+# define NEXT		continue
+# define FUSE(op, label)
+# endif
+# define POPRESULT()	if (instr & I_POP_BIT) {			\
+			    (sp++)->del();				\
+			}
+# define POPNEXT	POPRESULT(); NEXT
+
 /*
  * Main interpreter function. Interpret stack machine code.
  */
@@ -1838,128 +1942,218 @@ void Frame::interpret(char *pc)
 # ifdef LARGENUM
     Float flt;
 # endif
+# ifdef __GNUC__
+    static void *optab[I_INSTR_MASK + 1];
+
+    if (optab[I_RETURN] == NULL) {
+	for (instr = 0; instr <= I_INSTR_MASK; instr++) {
+	    optab[instr] = &&op_illegal;
+	}
+	optab[I_PUSH_INT1] = &&op_push_int1;
+	optab[I_PUSH_INT2] = &&op_push_int2;
+	optab[I_PUSH_INT4] = &&op_push_int4;
+# ifdef LARGENUM
+	optab[I_PUSH_INT8] = &&op_push_int8;
+	optab[I_PUSH_FLOAT12] = &&op_push_float12;
+# endif
+	optab[I_PUSH_FLOAT6] = &&op_push_float6;
+	optab[I_PUSH_STRING] = &&op_push_string;
+	optab[I_PUSH_NEAR_STRING] = &&op_push_near_string;
+	optab[I_PUSH_FAR_STRING] = &&op_push_far_string;
+	optab[I_PUSH_LOCAL] = &&op_push_local;
+	optab[I_PUSH_GLOBAL] = &&op_push_global;
+	optab[I_PUSH_FAR_GLOBAL] = &&op_push_far_global;
+	optab[I_INDEX] = optab[I_INDEX | I_POP_BIT] = &&op_index;
+	optab[I_INDEX2] = &&op_index2;
+	optab[I_SPREAD] = &&op_spread;
+	optab[I_AGGREGATE] = optab[I_AGGREGATE | I_POP_BIT] = &&op_aggregate;
+	optab[I_CAST] = optab[I_CAST | I_POP_BIT] = &&op_cast;
+	optab[I_INSTANCEOF] = optab[I_INSTANCEOF | I_POP_BIT] =
+			      &&op_instanceof;
+	optab[I_STORES] = optab[I_STORES | I_POP_BIT] = &&op_stores;
+	optab[I_STORE_LOCAL] = optab[I_STORE_LOCAL | I_POP_BIT] =
+			       &&op_store_local;
+	optab[I_STORE_GLOBAL] = optab[I_STORE_GLOBAL | I_POP_BIT] =
+				&&op_store_global;
+	optab[I_STORE_FAR_GLOBAL] = optab[I_STORE_FAR_GLOBAL | I_POP_BIT] =
+				    &&op_store_far_global;
+	optab[I_STORE_INDEX] = optab[I_STORE_INDEX | I_POP_BIT] =
+			       &&op_store_index;
+	optab[I_STORE_LOCAL_INDEX] = optab[I_STORE_LOCAL_INDEX | I_POP_BIT] =
+				     &&op_store_local_index;
+	optab[I_STORE_GLOBAL_INDEX] = optab[I_STORE_GLOBAL_INDEX | I_POP_BIT] =
+				      &&op_store_global_index;
+	optab[I_STORE_FAR_GLOBAL_INDEX] =
+		optab[I_STORE_FAR_GLOBAL_INDEX | I_POP_BIT] =
+		&&op_store_far_global_index;
+	optab[I_STORE_INDEX_INDEX] = optab[I_STORE_INDEX_INDEX | I_POP_BIT] =
+				     &&op_store_index_index;
+	optab[I_JUMP_ZERO] = &&op_jump_zero;
+	optab[I_JUMP_NONZERO] = &&op_jump_nonzero;
+	optab[I_JUMP] = &&op_jump;
+	optab[I_SWITCH] = &&op_switch;
+	optab[I_CALL_KFUNC] = optab[I_CALL_KFUNC | I_POP_BIT] =
+			      &&op_call_kfunc;
+	optab[I_CALL_EFUNC] = optab[I_CALL_EFUNC | I_POP_BIT] =
+			      &&op_call_efunc;
+	optab[I_CALL_CKFUNC] = optab[I_CALL_CKFUNC | I_POP_BIT] =
+			       &&op_call_ckfunc;
+	optab[I_CALL_CEFUNC] = optab[I_CALL_CEFUNC | I_POP_BIT] =
+			       &&op_call_cefunc;
+	optab[I_CALL_AFUNC] = optab[I_CALL_AFUNC | I_POP_BIT] =
+			      &&op_call_afunc;
+	optab[I_CALL_DFUNC] = optab[I_CALL_DFUNC | I_POP_BIT] =
+			      &&op_call_dfunc;
+	optab[I_CALL_FUNC] = optab[I_CALL_FUNC | I_POP_BIT] = &&op_call_func;
+	optab[I_CATCH] = optab[I_CATCH | I_POP_BIT] = &&op_catch;
+	optab[I_RLIMITS] = &&op_rlimits;
+	optab[I_RETURN] = &&op_return;
+    }
+# endif
 
     size = 0;
     l = 0;
 
     for (;;) {
-# ifdef DEBUG
-	if (sp < stack + MIN_STACK) {
-	    EC->fatal("out of value stack");
-	}
-# endif
+	CHECKSTACK();
 	instr = FETCH1U(pc);
 	this->pc = pc;
 
 	switch (instr & I_INSTR_MASK) {
 	case I_PUSH_INT1:
+	OP(op_push_int1)
 	    PUSH_INTVAL(this, FETCH1S(pc));
-	    continue;
+	    FUSE(I_CALL_KFUNC, op_call_kfunc);
+	    NEXT;
 
 	case I_PUSH_INT2:
+	OP(op_push_int2)
 	    PUSH_INTVAL(this, FETCH2S(pc, u));
-	    continue;
+	    NEXT;
 
 	case I_PUSH_INT4:
+	OP(op_push_int4)
 	    PUSH_INTVAL(this, FETCH4S(pc, l));
-	    continue;
+	    NEXT;
 
 # ifdef LARGENUM
 	case I_PUSH_INT8:
+	OP(op_push_int8)
 	    PUSH_INTVAL(this, FETCH8S(pc, l));
-	    continue;
+	    NEXT;
 
 	case I_PUSH_FLOAT6:
+	OP(op_push_float6)
 	    FETCH2U(pc, u);
 	    Ext::largeFloat(&flt, u, FETCH4U(pc, l));
 	    PUSH_FLTVAL(this, flt);
-	    continue;
+	    NEXT;
 
 	case I_PUSH_FLOAT12:
+	OP(op_push_float12)
 	    FETCH4U(pc, l);
 	    flt.high = l;
 	    FETCH8U(pc, l);
 	    flt.low = l;
 	    PUSH_FLTVAL(this, flt);
-	    continue;
+	    NEXT;
 # else
 	case I_PUSH_FLOAT6:
+	OP(op_push_float6)
 	    FETCH2U(pc, u);
 	    PUSH_FLTCONST(this, u, FETCH4U(pc, l));
-	    continue;
+	    NEXT;
 # endif
 
 	case I_PUSH_STRING:
+	OP(op_push_string)
 	    PUSH_STRVAL(this, p_ctrl->strconst(p_ctrl->ninherits - 1,
 					       FETCH1U(pc)));
-	    continue;
+	    NEXT;
 
 	case I_PUSH_NEAR_STRING:
+	OP(op_push_near_string)
 	    u = FETCH1U(pc);
 	    PUSH_STRVAL(this, p_ctrl->strconst(u, FETCH1U(pc)));
-	    continue;
+	    NEXT;
 
 	case I_PUSH_FAR_STRING:
+	OP(op_push_far_string)
 	    u = FETCH1U(pc);
 	    PUSH_STRVAL(this, p_ctrl->strconst(u, FETCH2U(pc, u2)));
-	    continue;
+	    NEXT;
 
 	case I_PUSH_LOCAL:
+	OP(op_push_local)
 	    u = FETCH1S(pc);
 	    pushValue(((short) u < 0) ? fp + (short) u : argp + u);
-	    continue;
+	    FUSE(I_PUSH_LOCAL, op_push_local);
+	    FUSE(I_CALL_KFUNC, op_call_kfunc);
+	    FUSE(I_INDEX, op_index);
+	    NEXT;
 
 	case I_PUSH_GLOBAL:
+	OP(op_push_global)
 	    pushValue(global(p_ctrl->ninherits - 1, FETCH1U(pc)));
-	    continue;
+	    NEXT;
 
 	case I_PUSH_FAR_GLOBAL:
+	OP(op_push_far_global)
 	    u = FETCH1U(pc);
 	    pushValue(global(u, FETCH1U(pc)));
-	    continue;
+	    NEXT;
 
 	case I_INDEX:
 	case I_INDEX | I_POP_BIT:
+	OP(op_index)
 	    index(sp + 1, sp, &val, FALSE);
 	    *++sp = val;
-	    break;
+	    POPRESULT();
+	    FUSE(I_CAST, op_cast);
+	    NEXT;
 
 	case I_INDEX2:
+	OP(op_index2)
 	    index(sp + 1, sp, &val, TRUE);
 	    *--sp = val;
-	    continue;
+	    NEXT;
 
 	case I_AGGREGATE:
 	case I_AGGREGATE | I_POP_BIT:
+	OP(op_aggregate)
 	    if (FETCH1U(pc) == 0) {
 		aggregate(FETCH2U(pc, u));
 	    } else {
 		mapAggregate(FETCH2U(pc, u));
 	    }
-	    break;
+	    POPNEXT;
 
 	case I_SPREAD:
+	OP(op_spread)
 	    u = FETCH1S(pc);
 	    size = spread(-(short) u - 2);
-	    continue;
+	    NEXT;
 
 	case I_CAST:
 	case I_CAST | I_POP_BIT:
+	OP(op_cast)
 	    u = FETCH1U(pc);
 	    if (u == T_CLASS) {
 		FETCH3U(pc, l);
 	    }
 	    cast(sp, u, l);
-	    break;
+	    POPNEXT;
 
 	case I_INSTANCEOF:
 	case I_INSTANCEOF | I_POP_BIT:
+	OP(op_instanceof)
 	    instance = instanceOf(FETCH3U(pc, l));
 	    PUT_INTVAL(sp, instance);
-	    break;
+	    POPNEXT;
 
 	case I_STORES:
 	case I_STORES | I_POP_BIT:
+	OP(op_stores)
 	    if (p_ctrl->version >= 2) {
 		FETCH2U(pc, u);
 	    } else {
@@ -1988,61 +2182,74 @@ void Frame::interpret(char *pc)
 		}
 	    }
 	    pc = this->pc;
-	    break;
+	    POPNEXT;
 
 	case I_STORE_LOCAL:
 	case I_STORE_LOCAL | I_POP_BIT:
+	OP(op_store_local)
 	    u = FETCH1U(pc);
 	    if (SCHAR(u) >= 0) {
 		storeParam(u, sp);
 	    } else {
 		storeLocal(-SCHAR(u), sp);
 	    }
-	    break;
+	    POPRESULT();
+	    FUSE(I_PUSH_LOCAL, op_push_local);
+	    NEXT;
 
 	case I_STORE_GLOBAL:
 	case I_STORE_GLOBAL | I_POP_BIT:
+	OP(op_store_global)
 	    storeGlobal(p_ctrl->ninherits - 1, FETCH1U(pc), sp);
-	    break;
+	    POPNEXT;
 
 	case I_STORE_FAR_GLOBAL:
 	case I_STORE_FAR_GLOBAL | I_POP_BIT:
+	OP(op_store_far_global)
 	    u = FETCH1U(pc);
 	    storeGlobal(u, FETCH1U(pc), sp);
-	    break;
+	    POPNEXT;
 
 	case I_STORE_INDEX:
 	case I_STORE_INDEX | I_POP_BIT:
+	OP(op_store_index)
 	    storeIndex(sp);
-	    break;
+	    POPNEXT;
 
 	case I_STORE_LOCAL_INDEX:
 	case I_STORE_LOCAL_INDEX | I_POP_BIT:
+	OP(op_store_local_index)
 	    u = FETCH1S(pc);
 	    if (SCHAR(u) >= 0) {
 		storeParamIndex(u, sp);
 	    } else {
 		storeLocalIndex(-SCHAR(u), sp);
 	    }
-	    break;
+	    POPRESULT();
+	    FUSE(I_PUSH_LOCAL, op_push_local);
+	    NEXT;
 
 	case I_STORE_GLOBAL_INDEX:
 	case I_STORE_GLOBAL_INDEX | I_POP_BIT:
+	OP(op_store_global_index)
 	    storeGlobalIndex(p_ctrl->ninherits - 1, FETCH1U(pc), sp);
-	    break;
+	    POPNEXT;
 
 	case I_STORE_FAR_GLOBAL_INDEX:
 	case I_STORE_FAR_GLOBAL_INDEX | I_POP_BIT:
+	OP(op_store_far_global_index)
 	    u = FETCH1U(pc);
 	    storeGlobalIndex(u, FETCH1U(pc), sp);
-	    break;
+	    POPNEXT;
 
 	case I_STORE_INDEX_INDEX:
 	case I_STORE_INDEX_INDEX | I_POP_BIT:
+	OP(op_store_index_index)
 	    storeIndexIndex(sp);
-	    break;
+	    POPNEXT;
 
 	case I_JUMP_ZERO:
+	OP(op_jump_zero)
 	    p = prog + FETCH2U(pc, u);
 	    if (!VAL_TRUE(sp)) {
 		if (p < pc) {
@@ -2051,9 +2258,11 @@ void Frame::interpret(char *pc)
 		pc = p;
 	    }
 	    (sp++)->del();
-	    continue;
+	    FUSE(I_PUSH_LOCAL, op_push_local);
+	    NEXT;
 
 	case I_JUMP_NONZERO:
+	OP(op_jump_nonzero)
 	    p = prog + FETCH2U(pc, u);
 	    if (VAL_TRUE(sp)) {
 		if (p < pc) {
@@ -2062,17 +2271,20 @@ void Frame::interpret(char *pc)
 		pc = p;
 	    }
 	    (sp++)->del();
-	    continue;
+	    FUSE(I_PUSH_LOCAL, op_push_local);
+	    NEXT;
 
 	case I_JUMP:
+	OP(op_jump)
 	    p = prog + FETCH2U(pc, u);
 	    if (p < pc) {
 		loopTicks();
 	    }
 	    pc = p;
-	    continue;
+	    NEXT;
 
 	case I_SWITCH:
+	OP(op_switch)
 	    switch (FETCH1U(pc)) {
 	    case SWITCH_INT:
 		p = prog + switchInt(pc);
@@ -2091,10 +2303,11 @@ void Frame::interpret(char *pc)
 	    }
 	    pc = p;
 	    (sp++)->del();
-	    continue;
+	    NEXT;
 
 	case I_CALL_KFUNC:
 	case I_CALL_KFUNC | I_POP_BIT:
+	OP(op_call_kfunc)
 	    u = FETCH1U(pc);
 	    kf = &KFUN(u);
 	    if (PROTO_VARGS(kf->proto) != 0) {
@@ -2106,12 +2319,19 @@ void Frame::interpret(char *pc)
 		u2 = PROTO_NARGS(kf->proto);
 	    }
 	    this->pc = pc;
-	    kfunc(u, u2);
+	    if (u != KF_ADD || !appendLocal(pc)) {
+		kfunc(u, u2);
+	    }
 	    pc = this->pc;
-	    break;
+	    POPRESULT();
+	    FUSE(I_STORE_LOCAL | I_POP_BIT, op_store_local);
+	    FUSE(I_JUMP_ZERO, op_jump_zero);
+	    FUSE(I_JUMP_NONZERO, op_jump_nonzero);
+	    NEXT;
 
 	case I_CALL_EFUNC:
 	case I_CALL_EFUNC | I_POP_BIT:
+	OP(op_call_efunc)
 	    FETCH2U(pc, u);
 	    kf = &KFUN(u);
 	    if (PROTO_VARGS(kf->proto) != 0) {
@@ -2125,53 +2345,59 @@ void Frame::interpret(char *pc)
 	    this->pc = pc;
 	    kfunc(u, u2);
 	    pc = this->pc;
-	    break;
+	    POPNEXT;
 
 	case I_CALL_CKFUNC:
 	case I_CALL_CKFUNC | I_POP_BIT:
+	OP(op_call_ckfunc)
 	    u = FETCH1U(pc);
 	    u2 = FETCH1U(pc) + size;
 	    size = 0;
 	    this->pc = pc;
 	    kfunc(u, u2);
 	    pc = this->pc;
-	    break;
+	    POPNEXT;
 
 	case I_CALL_CEFUNC:
 	case I_CALL_CEFUNC | I_POP_BIT:
+	OP(op_call_cefunc)
 	    FETCH2U(pc, u);
 	    u2 = FETCH1U(pc) + size;
 	    size = 0;
 	    this->pc = pc;
 	    kfunc(u, u2);
 	    pc = this->pc;
-	    break;
+	    POPNEXT;
 
 	case I_CALL_AFUNC:
 	case I_CALL_AFUNC | I_POP_BIT:
+	OP(op_call_afunc)
 	    u = FETCH1U(pc);
 	    funcall((Object *) NULL, (LWO *) NULL, 0, u, FETCH1U(pc) + size);
 	    size = 0;
-	    break;
+	    POPNEXT;
 
 	case I_CALL_DFUNC:
 	case I_CALL_DFUNC | I_POP_BIT:
+	OP(op_call_dfunc)
 	    u = FETCH1U(pc);
 	    u2 = FETCH1U(pc);
 	    funcall((Object *) NULL, (LWO *) NULL,
 		    UCHAR(ctrl->imap[p_index + u]), u2, FETCH1U(pc) + size);
 	    size = 0;
-	    break;
+	    POPNEXT;
 
 	case I_CALL_FUNC:
 	case I_CALL_FUNC | I_POP_BIT:
+	OP(op_call_func)
 	    FETCH2U(pc, u);
 	    vfunc(u, FETCH1U(pc) + size);
 	    size = 0;
-	    break;
+	    POPNEXT;
 
 	case I_CATCH:
 	case I_CATCH | I_POP_BIT:
+	OP(op_catch)
 	    atomic = this->atomic;
 	    p = prog + FETCH2U(pc, u);
 	    try {
@@ -2193,27 +2419,23 @@ void Frame::interpret(char *pc)
 		PUSH_STRVAL(this, EC->exception());
 	    }
 	    this->atomic = atomic;
-	    break;
+	    POPNEXT;
 
 	case I_RLIMITS:
+	OP(op_rlimits)
 	    rlimits(FETCH1U(pc));
 	    interpret(pc);
 	    pc = this->pc;
 	    setRlimits(rlim->next);
-	    continue;
+	    NEXT;
 
 	case I_RETURN:
+	OP(op_return)
 	    return;
 
-# ifdef DEBUG
 	default:
+	OP(op_illegal)
 	    EC->fatal("illegal instruction");
-# endif
-	}
-
-	if (instr & I_POP_BIT) {
-	    /* pop the result of the last operation */
-	    (sp++)->del();
 	}
     }
 }
@@ -2431,10 +2653,16 @@ void Frame::funcall(Object *obj, LWO *lwobj, int p_ctrli, int funci, int nargs)
 
     /* execute code */
     f.source = 0;
+    if (Profile::active) {
+	Profile::enter(&f);
+    }
     if (!Ext::execute(&f, funci)) {
 	f.prog = pc += 2;
 	f.interpret(pc);
     }
+    if (Profile::active) {
+	Profile::leave(&f);
+    }
     val = *f.sp++;
 
     /* clean up stack, move return value to outer stackframe */
@@ -2477,6 +2705,8 @@ bool Frame::call(Object *obj, LWO *lwobj, const char *func, unsigned int len,
     Symbol *symb;
     FuncDef *fdef;
     Control *ctrl;
+    CallCache *c;
+    int inherit, index;
 
     if (lwobj != (LWO *) NULL) {
 	uindex oindex;
@@ -2544,17 +2774,41 @@ bool Frame::call(Object *obj, LWO *lwobj, const char *func, unsigned int len,
 	len = clen;
     }
 
-    /* find the function in the symbol table */
+    /*
+     * find the function, first in the cache slot for this name string and
+     * program, then in the symbol table
+     */
     ctrl = obj->control();
-    symb = ctrl->symb(func, len);
-    if (symb == (Symbol *) NULL) {
-	/* function doesn't exist in symbol table */
-	pop(nargs);
-	return FALSE;
+    c = &ccache[(((uintptr_t) func >> 3) ^ (ctrl->oindex << 4) ^
+		 ctrl->instance) % CALLCACHESZ];
+    if (c->oindex == ctrl->oindex && c->instance == ctrl->instance &&
+	c->len == len && memcmp(c->func, func, len) == 0) {
+	chits++;
+	inherit = UCHAR(c->inherit);
+	index = UCHAR(c->index);
+    } else {
+	cmisses++;
+	symb = ctrl->symb(func, len);
+	if (symb == (Symbol *) NULL) {
+	    /* function doesn't exist in symbol table */
+	    pop(nargs);
+	    return FALSE;
+	}
+	inherit = UCHAR(symb->inherit);
+	index = UCHAR(symb->index);
+
+	if (len <= CALLNAMESZ) {
+	    c->oindex = ctrl->oindex;
+	    c->instance = ctrl->instance;
+	    c->len = len;
+	    c->inherit = inherit;
+	    c->index = index;
+	    memcpy(c->func, func, len);
+	}
     }
 
-    ctrl = OBJR(ctrl->inherits[UCHAR(symb->inherit)].oindex)->ctrl;
-    fdef = &ctrl->funcs()[UCHAR(symb->index)];
+    ctrl = OBJR(ctrl->inherits[inherit].oindex)->ctrl;
+    fdef = &ctrl->funcs()[index];
 
     /* check if the function can be called */
     if (!call_static && (fdef->sclass & C_STATIC) &&
@@ -2564,7 +2818,7 @@ bool Frame::call(Object *obj, LWO *lwobj, const char *func, unsigned int len,
     }
 
     /* call the function */
-    funcall(obj, lwobj, UCHAR(symb->inherit), UCHAR(symb->index), nargs);
+    funcall(obj, lwobj, inherit, index, nargs);
 
     return TRUE;
 }
@@ -2820,7 +3074,7 @@ Array *Frame::funcTrace(Dataspace *data)
     unsigned short n;
     Value *args;
     Array *a;
-    unsigned short max_args;
+    ssizet max_args;
 
     max_args = Config::arraySize() - 5;
 
@@ -209,8 +209,10 @@ class Frame {
 public:
     void addTicks(int t) {
 	rlim->ticks -= t;
+	ticksSpent += t;
     }
     void loopTicks() {
+	ticksSpent += 5;
 	if ((rlim->ticks -= 5) <= 0) {
 	    if (rlim->noticks) {
 		rlim->ticks = LPCINT_MAX;
@@ -247,7 +249,7 @@ public:
     void storeIndexIndex(Value *val);
     void storeSkip();
     void storeSkipSkip();
-    unsigned short storesSpread(int n, int offset, int type, Uint sclass);
+    ssizet storesSpread(int n, int offset, int type, Uint sclass);
     void toFloat(class Float *flt);
     LPCint toInt();
     void kfunc(int n, int nargs);
@@ -265,6 +267,8 @@ public:
 
     static void init(char *create, bool flag);
     static int instanceOf(unsigned int oindex, char *prog);
+    static void flushCalls();
+    static void callInfo(size_t *hits, size_t *misses);
     static LPCint div(LPCint num, LPCint denom);
     static LPCint lshift(LPCint num, LPCint shift);
     static LPCint mod(LPCint num, LPCint denom);
@@ -272,6 +276,8 @@ public:
     static void runtimeError(Frame *f, LPCint depth);
     static void clear();
 
+    static Uint ticksSpent;	/* total ticks spent */
+
     Frame *prev;		/* previous stack frame */
     uindex oindex;		/* current object index */
     LWO *lwobj;			/* lightweight object */
@@ -294,6 +300,8 @@ public:
     bool kflv;			/* kfun with lvalue parameters */
 
 private:
+    friend class Profile;
+
     void string(int inherit, unsigned int index);
     void oper(LWO *lwobj, const char *op, int nargs, Value *var, Value *idx,
 	      Value *val);
@@ -301,6 +309,7 @@ private:
     int instanceOf(unsigned int oindex, Uint sclass);
     bool storeIndex(Value *var, Value *aval, Value *ival, Value *val);
     void stores(int skip, int assign);
+    bool appendLocal(char *pc);
     void checkRlimits();
     void newRlimits(LPCint depth, LPCint t);
     void typecheck(Frame *f, const char *name, const char *ftype, char *proto,
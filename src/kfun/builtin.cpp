@@ -1413,7 +1413,7 @@ int kf_rangef(Frame *f, int n, KFun *kf)
 	    kf->argError(2);
 	}
 	a = f->sp[1].array->range(f->data, f->sp->number,
-				  f->sp[1].array->size - 1);
+				  (LPCint) f->sp[1].array->size - 1);
 	f->addTicks(a->size);
 	f->sp++;
 	f->sp->array->del();
@@ -1543,7 +1543,7 @@ int kf_range(Frame *f, int n, KFun *kf)
 	break;
 
     case T_ARRAY:
-	a = f->sp->array->range(f->data, 0, f->sp->array->size - 1);
+	a = f->sp->array->range(f->data, 0, (LPCint) f->sp->array->size - 1);
 	f->addTicks(a->size);
 	f->sp->array->del();
 	PUT_ARR(f->sp, a);
@@ -3161,7 +3161,7 @@ int kf_sum(Frame *f, int nargs, KFun *kf)
 	    if (v->number < 0) {
 		EC->error("Bad argument 1 for kfun allocate");
 	    }
-	    if (v->number > Config::arraySize()) {
+	    if (v->number > (LPCint) Config::arraySize()) {
 		EC->error("Array too large");
 	    }
 	    size += v->number;
@@ -3173,7 +3173,7 @@ int kf_sum(Frame *f, int nargs, KFun *kf)
 	    if (v->number < 0) {
 		EC->error("Bad argument 1 for kfun allocate_int");
 	    }
-	    if (v->number > Config::arraySize()) {
+	    if (v->number > (LPCint) Config::arraySize()) {
 		EC->error("Array too large");
 	    }
 	    size += v->number;
@@ -3185,7 +3185,7 @@ int kf_sum(Frame *f, int nargs, KFun *kf)
 	    if (v->number < 0) {
 		EC->error("Bad argument 1 for kfun allocate_float");
 	    }
-	    if (v->number > Config::arraySize()) {
+	    if (v->number > (LPCint) Config::arraySize()) {
 		EC->error("Array too large");
 	    }
 	    size += v->number;
@@ -240,7 +240,7 @@ static void save_array(savecontext *x, Array *a)
     }
     x->narrays++;
 
-    snprintf(buf, sizeof(buf), "({%d|", a->size);
+    snprintf(buf, sizeof(buf), "({%lu|", (unsigned long) a->size);
     put(x, buf, strlen(buf));
     for (i = a->size, v = Dataspace::elts(a); i > 0; --i, v++) {
 	switch (v->type) {
@@ -291,7 +291,7 @@ static void save_mapping(savecontext *x, Mapping *a)
 {
     char buf[LPCINT_BUFFER];
     Uint i;
-    uindex n;
+    ssizet n;
     Value *v;
     Float flt;
 
@@ -322,7 +322,7 @@ static void save_mapping(savecontext *x, Mapping *a)
 	}
 	v++;
     }
-    snprintf(buf, sizeof(buf), "([%d|", n);
+    snprintf(buf, sizeof(buf), "([%lu|", (unsigned long) n);
     put(x, buf, strlen(buf));
 
     for (i = a->size >> 1, v = a->elts; i > 0; --i) {
@@ -760,7 +760,7 @@ static char *restore_mapping	(restcontext*, char*, Value*);
  */
 static char *restore_array(restcontext *x, char *buf, Value *val)
 {
-    unsigned short i;
+    ssizet i;
     Value *v;
     Array *a;
 
@@ -811,7 +811,7 @@ static char *restore_array(restcontext *x, char *buf, Value *val)
  */
 static char *restore_mapping(restcontext *x, char *buf, Value *val)
 {
-    unsigned short i;
+    ssizet i;
     Value *v;
     Mapping *a;
 
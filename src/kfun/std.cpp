@@ -22,6 +22,7 @@
 # include "path.h"
 # include "comm.h"
 # include "call_out.h"
+# include "profile.h"
 # include "editor.h"
 # include "node.h"
 # include "compile.h"
@@ -757,7 +758,7 @@ char pt_sizeof[] = { C_TYPECHECKED | C_STATIC, 1, 0, 0, 7, T_INT,
  */
 int kf_sizeof(Frame *f, int n, KFun *kf)
 {
-    unsigned short size;
+    ssizet size;
 
     UNREFERENCED_PARAMETER(n);
     UNREFERENCED_PARAMETER(kf);
@@ -831,13 +832,13 @@ char pt_map_sizeof[] = { C_TYPECHECKED | C_STATIC, 1, 0, 0, 7, T_INT,
  */
 int kf_map_sizeof(Frame *f, int n, KFun *kf)
 {
-    unsigned short size;
+    ssizet size;
 
     UNREFERENCED_PARAMETER(n);
     UNREFERENCED_PARAMETER(kf);
 
     f->addTicks(f->sp->array->size);
-    size = dynamic_cast<Mapping *> (f->sp->array)->msize(f->data);
+    size = dynamic_cast<Mapping *> (f->sp->array)->count(f->data);
     f->sp->array->del();
     PUT_INTVAL(f->sp, size);
     return 0;
@@ -1302,6 +1303,49 @@ int kf_dump_state(Frame *f, int nargs, KFun *kf)
 # endif
 
 
+# ifdef FUNCDEF
+FUNCDEF("profile", kf_profile, pt_profile, 0)
+# else
+char pt_profile[] = { C_TYPECHECKED | C_STATIC, 0, 2, 0, 8, T_INT, T_STRING,
+		      T_INT };
+
+/*
+ * start profiling, or stop profiling and write folded stacks to a file
+ */
+int kf_profile(Frame *f, int nargs, KFun *kf)
+{
+    char file[STRINGSZ];
+    LPCint metric;
+
+    UNREFERENCED_PARAMETER(kf);
+
+    if (nargs == 0) {
+	Profile::start();
+	PUSH_INTVAL(f, 1);
+	return 0;
+    }
+
+    metric = (nargs < 2) ? PROF_TICKS : (f->sp++)->number;
+    if (metric < 0 || metric >= PROF_METRICS) {
+	return 2;
+    }
+    if (PM->string(file, f->sp->string->text,
+		   f->sp->string->len) == (char *) NULL) {
+	return 1;
+    }
+    if (f->level != 0) {
+	EC->error("profile() within atomic function");
+    }
+
+    f->addTicks(1000);
+    Profile::stop();
+    f->sp->string->del();
+    PUT_INTVAL(f->sp, Profile::write(file, metric));
+    return 0;
+}
+# endif
+
+
 # ifdef FUNCDEF
 FUNCDEF("connect", kf_connect, pt_connect, 1)
 # else
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2025 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -222,7 +222,12 @@ Object *Object::access(unsigned int index, int access)
 	 */
 	obj = &oplane->optab->patch(index, access, oplane)->obj;
 	if (obj->name != (char *) NULL && obj->count != 0) {
-	    *oplane->htab->lookup(obj->name, FALSE) = obj;
+	    Hash::Entry **h;
+
+	    /* the lookup may relink the chain that the patched object is in */
+	    h = oplane->htab->lookup(obj->name, FALSE);
+	    obj->next = (*h)->next;
+	    *h = obj;
 	}
     } else {
 	/*
@@ -447,9 +452,11 @@ void Object::discardPlane()
 			 * remove new name
 			 */
 			if (op->obj.count != 0) {
+			    Hash::Entry **h;
+
 			    /* remove from hash table */
-			    *oplane->htab->lookup(op->obj.name, FALSE)
-								= op->obj.next;
+			    h = oplane->htab->lookup(op->obj.name, FALSE);
+			    *h = op->obj.next;
 			}
 			FREE(op->obj.name);
 		    } else {
@@ -506,6 +513,10 @@ void Object::discardPlane()
 	}
 
 	/* discard new control blocks */
+	if (clist != (ObjPatch *) NULL) {
+	    /* their object indices will be reused */
+	    Frame::flushCalls();
+	}
 	while (clist != (ObjPatch *) NULL) {
 	    obj = &clist->obj;
 	    obj->ctrl->del();
@@ -711,8 +722,11 @@ void Object::del(Frame *f)
     objDestrCount++;
 
     if (flags & O_MASTER) {
+	Hash::Entry **h;
+
 	/* remove from object name hash table */
-	*oplane->htab->lookup(name, FALSE) = next;
+	h = oplane->htab->lookup(name, FALSE);
+	*h = next;
 
 	if (--ref == 0) {
 	    remove(f);
@@ -909,6 +923,25 @@ Dataspace *Object::dataspace()
     return data;
 }
 
+/*
+ * announce that the control block and dataspace of an object will be
+ * needed soon
+ */
+void Object::prefetch()
+{
+    Object *o;
+
+    o = (flags & O_MASTER) ? this : OBJ(master);
+    if (o->ctrl == (Control *) NULL && o->cfirst != SW_UNUSED &&
+	!BTST(omap, o->index)) {
+	Swap::prefetch(&o->cfirst, 1);
+    }
+    if (data == (Dataspace *) NULL && dfirst != SW_UNUSED &&
+	!BTST(omap, index)) {
+	Swap::prefetch(&dfirst, 1);
+    }
+}
+
 /*
  * clean up upgrade templates
  */
@@ -1017,6 +1050,10 @@ void Object::clean()
 
     cleanUpgrades();		/* 1st time */
 
+    if (baseplane.upgrade != OBJ_NONE) {
+	/* programs are about to change */
+	Frame::flushCalls();
+    }
     while (baseplane.upgrade != OBJ_NONE) {
 	Object *up;
 	Control *ctrl;
@@ -1097,6 +1134,9 @@ void Object::clean()
 
     cleanUpgrades();		/* 2nd time */
 
+    if (baseplane.destruct != OBJ_NONE) {
+	Frame::flushCalls();
+    }
     while (baseplane.destruct != OBJ_NONE) {
 	o = OBJ(baseplane.destruct);
 	baseplane.destruct = o->cref;
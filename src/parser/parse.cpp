@@ -253,8 +253,10 @@ Parser *Parser::create(Frame *f, String *source, String *grammar)
     ps->data->parser = ps;
     ps->source = source;
     ps->source->ref();
+    ps->source->promote();
     ps->grammar = grammar;
     ps->grammar->ref();
+    ps->grammar->promote();
     ps->fastr = (char *) NULL;
     ps->lrstr = (char *) NULL;
     ps->fa = Dfa::create(source->text, grammar->text);
@@ -820,8 +822,10 @@ Parser *Parser::load(Frame *f, Value *elts)
     lrsize = (elts++)->number & 0xffff;
     ps->source = (elts++)->string;
     ps->source->ref();
+    ps->source->promote();
     ps->grammar = (elts++)->string;
     ps->grammar->ref();
+    ps->grammar->promote();
 
     if (fasize > 1) {
 	for (i = fasize, len = 0; --i >= 0; ) {
@@ -834,6 +838,7 @@ Parser *Parser::load(Frame *f, Value *elts)
 	}
 	p -= len;
     } else {
+	elts->string->promote();
 	p = elts->string->text;
 	len = (elts++)->string->len;
 	ps->fastr = (char *) NULL;
@@ -851,6 +856,7 @@ Parser *Parser::load(Frame *f, Value *elts)
 	}
 	p -= len;
     } else {
+	elts->string->promote();
 	p = elts->string->text;
 	len = elts->string->len;
 	ps->lrstr = (char *) NULL;
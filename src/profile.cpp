@@ -0,0 +1,330 @@
+/*
+ * This file is part of DGD, https://github.com/dworkin/dgd
+ * Copyright (C) 1993-2010 Dworkin B.V.
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+# define INCLUDE_FILE_IO
+# include <chrono>
+# include "dgd.h"
+# include "str.h"
+# include "array.h"
+# include "object.h"
+# include "xfloat.h"
+# include "data.h"
+# include "interpret.h"
+# include "control.h"
+# include "profile.h"
+
+struct ProfEntry : public Hash::Entry {
+    uint64_t count[PROF_METRICS];	/* accumulated cost */
+};
+
+struct ProfLevel {
+    LPCint depth;		/* stack depth of frame */
+    Uint end;			/* end of frame label in folded stack */
+};
+
+bool Profile::active;			/* profiling? */
+static Hash::Hashtab *ptab;		/* folded stack table */
+static char *stack;			/* current folded stack */
+static Uint stacklen;			/* length of current folded stack */
+static Uint stacksz;			/* size of folded stack buffer */
+static ProfLevel *levels;		/* frames in current folded stack */
+static Uint nlevels;			/* # frames in current folded stack */
+static Uint levelsz;			/* size of frame buffer */
+static Uint lticks;			/* ticks at last sample */
+static uint64_t ltime;			/* time at last sample */
+static size_t lmem;			/* allocated memory at last sample */
+
+/*
+ * current time in microseconds
+ */
+static uint64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>
+		(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/*
+ * append to the current folded stack
+ */
+static void append(const char *str, Uint len)
+{
+    if (stacklen + len >= stacksz) {
+	MM->staticMode();
+	stack = REALLOC(stack, char, stacksz, (stacklen + len) * 2);
+	MM->dynamicMode();
+	stacksz = (stacklen + len) * 2;
+    }
+    memcpy(stack + stacklen, str, len);
+    stacklen += len;
+}
+
+/*
+ * current line number of a function
+ */
+unsigned short Profile::line(Frame *f)
+{
+    return (f->source != 0) ? f->source : f->line();
+}
+
+/*
+ * free the folded stack table
+ */
+void Profile::clear()
+{
+    Hash::Entry **t, *e, *next;
+    Uint i;
+
+    if (ptab != (Hash::Hashtab *) NULL) {
+	ptab->settle();
+	for (i = ptab->size, t = ptab->table; i != 0; --i, t++) {
+	    for (e = *t; e != (Hash::Entry *) NULL; e = next) {
+		next = e->next;
+		FREE(e->name);
+		FREE(e);
+	    }
+	}
+	delete ptab;
+	ptab = (Hash::Hashtab *) NULL;
+    }
+}
+
+/*
+ * start profiling
+ */
+void Profile::start()
+{
+    clear();
+    MM->staticMode();
+    ptab = HM->create(PROFTABSZ, USHRT_MAX, FALSE);
+    MM->dynamicMode();
+    nlevels = stacklen = 0;
+    sample();
+    active = TRUE;
+}
+
+/*
+ * stop profiling
+ */
+void Profile::stop()
+{
+    active = FALSE;
+}
+
+/*
+ * write the folded stacks for a metric to a file
+ */
+bool Profile::write(const char *file, int metric)
+{
+    char buffer[8192], num[24];
+    Hash::Entry **t;
+    ProfEntry *e;
+    Uint i, len, size;
+    int fd;
+
+    if (ptab == (Hash::Hashtab *) NULL) {
+	return FALSE;
+    }
+    fd = P_open(file, O_CREAT | O_TRUNC | O_WRONLY | O_BINARY, 0664);
+    if (fd < 0) {
+	return FALSE;
+    }
+
+    ptab->settle();
+    size = 0;
+    for (i = ptab->size, t = ptab->table; i != 0; --i, t++) {
+	for (e = (ProfEntry *) *t; e != (ProfEntry *) NULL;
+	     e = (ProfEntry *) e->next) {
+	    if (e->count[metric] == 0) {
+		continue;
+	    }
+	    len = strlen(e->name);
+	    if (size + len > sizeof(buffer)) {
+		if (P_write(fd, buffer, size) != size) {
+		    P_close(fd);
+		    return FALSE;
+		}
+		size = 0;
+		if (len > sizeof(buffer)) {
+		    if (P_write(fd, e->name, len) != len) {
+			P_close(fd);
+			return FALSE;
+		    }
+		    len = 0;
+		}
+	    }
+	    memcpy(buffer + size, e->name, len);
+	    size += len;
+	    len = snprintf(num, sizeof(num), " %llu\012",
+			   (unsigned long long) e->count[metric]);
+	    if (size + len > sizeof(buffer)) {
+		if (P_write(fd, buffer, size) != size) {
+		    P_close(fd);
+		    return FALSE;
+		}
+		size = 0;
+	    }
+	    memcpy(buffer + size, num, len);
+	    size += len;
+	}
+    }
+    if (size != 0 && P_write(fd, buffer, size) != size) {
+	P_close(fd);
+	return FALSE;
+    }
+    P_close(fd);
+    return TRUE;
+}
+
+/*
+ * add a frame to the current folded stack
+ */
+void Profile::label(Frame *f)
+{
+    const char *name;
+    String *str;
+    Uint start;
+    char *p;
+
+    if (nlevels == levelsz) {
+	MM->staticMode();
+	levels = REALLOC(levels, ProfLevel, levelsz, levelsz + 64);
+	MM->dynamicMode();
+	levelsz += 64;
+    }
+    start = stacklen;
+    name = OBJR(f->p_ctrl->oindex)->name;
+    append("/", 1);
+    append(name, strlen(name));
+    append("::", 2);
+    str = f->p_ctrl->strconst(f->func->inherit, f->func->index);
+    append(str->text, str->len);
+    for (p = stack + start; p != stack + stacklen; p++) {
+	/* keep the folded stack format intact */
+	if (*p == ';' || *p == ' ') {
+	    *p = '_';
+	}
+    }
+    levels[nlevels].depth = f->depth;
+    levels[nlevels++].end = stacklen;
+}
+
+/*
+ * rebuild the current folded stack from the frames on the stack
+ */
+void Profile::rebuild(Frame *f)
+{
+    char buffer[8];
+
+    if (f->prev->oindex != OBJ_NONE) {
+	rebuild(f->prev);
+	append(buffer, snprintf(buffer, sizeof(buffer), ":%u;",
+				line(f->prev)));
+    } else {
+	nlevels = stacklen = 0;
+    }
+    label(f);
+}
+
+/*
+ * make the given frame the last one in the current folded stack
+ */
+static bool settop(Frame *f)
+{
+    while (nlevels != 0 && levels[nlevels - 1].depth > f->depth) {
+	--nlevels;
+    }
+    if (nlevels != 0 && levels[nlevels - 1].depth == f->depth) {
+	stacklen = levels[nlevels - 1].end;
+	return TRUE;
+    }
+    return FALSE;
+}
+
+/*
+ * charge the cost since the last sample to the current folded stack, at
+ * the current line of the last frame
+ */
+void Profile::charge(Frame *f)
+{
+    char buffer[8];
+    ProfEntry **e;
+    size_t mem;
+
+    append(buffer, snprintf(buffer, sizeof(buffer), ":%u", line(f)));
+    stack[stacklen] = '\0';
+
+    e = (ProfEntry **) ptab->lookup(stack, FALSE);
+    if (*e == (ProfEntry *) NULL) {
+	MM->staticMode();
+	*e = ALLOC(ProfEntry, 1);
+	(*e)->name = strcpy(ALLOC(char, stacklen + 1), stack);
+	MM->dynamicMode();
+	(*e)->next = (Hash::Entry *) NULL;
+	memset((*e)->count, '\0', sizeof((*e)->count));
+    }
+    (*e)->count[PROF_TICKS] += Frame::ticksSpent - lticks;
+    (*e)->count[PROF_TIME] += now() - ltime;
+    mem = MM->info()->dmemalloc;
+    (*e)->count[PROF_MEMORY] += mem - lmem;
+}
+
+/*
+ * start measuring the cost of the next segment of execution
+ */
+void Profile::sample()
+{
+    lticks = Frame::ticksSpent;
+    lmem = MM->info()->dmemalloc;
+    ltime = now();
+}
+
+/*
+ * a function is called
+ */
+void Profile::enter(Frame *f)
+{
+    Frame *prev;
+
+    prev = f->prev;
+    if (prev->oindex == OBJ_NONE) {
+	/* called from outside the interpreter */
+	nlevels = stacklen = 0;
+    } else {
+	if (!settop(prev)) {
+	    rebuild(prev);
+	}
+	charge(prev);
+	append(";", 1);
+    }
+    label(f);
+    sample();
+}
+
+/*
+ * a function returns
+ */
+void Profile::leave(Frame *f)
+{
+    if (!settop(f)) {
+	rebuild(f);
+    }
+    charge(f);
+    stacklen = (--nlevels != 0) ? levels[nlevels - 1].end : 0;
+    sample();
+}
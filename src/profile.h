@@ -0,0 +1,42 @@
+/*
+ * This file is part of DGD, https://github.com/dworkin/dgd
+ * Copyright (C) 1993-2010 Dworkin B.V.
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+# define PROF_TICKS	0	/* ticks spent */
+# define PROF_TIME	1	/* wall time spent, in microseconds */
+# define PROF_MEMORY	2	/* dynamic memory allocated, in bytes */
+# define PROF_METRICS	3	/* # metrics */
+
+class Profile {
+public:
+    static void start();
+    static void stop();
+    static bool write(const char *file, int metric);
+    static void enter(Frame *f);
+    static void leave(Frame *f);
+
+    static bool active;		/* profiling? */
+
+private:
+    static unsigned short line(Frame *f);
+    static void label(Frame *f);
+    static void rebuild(Frame *f);
+    static void charge(Frame *f);
+    static void sample();
+    static void clear();
+};
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2025 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -25,21 +25,35 @@
 # include "data.h"
 
 # define STR_CHUNK	128
+# define STR_ARENA	262144		/* size of task arena */
+# define STR_ARENALEN	4096		/* max length of string in arena */
+# define STR_APPEND	64		/* initial size of appended-to text */
 
 struct StrHash : public Hash::Entry, public ChunkAllocated {
     String *str;		/* string entry */
     Uint index;			/* building index */
 };
 
+struct ArenaStr {
+    String *str;		/* string, or NULL if gone */
+    Uint size;			/* size of arena chunk */
+};
+
+# define ASTRSIZE	ALGN(sizeof(ArenaStr), STRUCT_AL)
+
 static Chunk<String, STR_CHUNK> schunk;
 static Chunk<StrHash, STR_CHUNK> hchunk;
 
 static Hash::Hashtab *sht;		/* string merge table */
+static char *arena;			/* task arena for string text */
+static char *atop;			/* first unused byte in task arena */
+static char *aend;			/* end of task arena */
+static Uint alive;			/* # live strings in task arena */
 
 
-String::String(const char *text, long len)
+String::String(const char *text, long len, char *buf)
 {
-    this->text = ALLOC(char, len + 1);
+    this->text = (buf != (char *) NULL) ? buf : ALLOC(char, len + 1);
     if (text != (char *) NULL && len > 0) {
 	memcpy(this->text, text, (unsigned int) len);
     }
@@ -50,7 +64,22 @@ String::String(const char *text, long len)
 
 String::~String()
 {
-    FREE(text);
+    if (text < atop && text >= arena) {
+	/* leave it to the arena */
+	((ArenaStr *) (text - ASTRSIZE))->str = (String *) NULL;
+	--alive;
+    } else {
+	FREE(text);
+    }
+}
+
+/*
+ * initialize the task arena
+ */
+void String::init()
+{
+    atop = arena = ALLOC(char, STR_ARENA);
+    aend = arena + STR_ARENA;
 }
 
 /*
@@ -59,18 +88,70 @@ String::~String()
  */
 String *String::alloc(const char *text, long len)
 {
-    return chunknew (schunk) String(text, len);
+    return chunknew (schunk) String(text, len, (char *) NULL);
 }
 
 /*
- * create a new string with size check
+ * Create a new string with size check.  The text of short strings is put in
+ * the task arena, which is reset at the end of the task.
  */
 String *String::create(const char *text, LPCint len)
 {
+    size_t size;
+    String *str;
+    ArenaStr *a;
+
     if (len > (LPCint) MAX_STRLEN) {
 	EC->error("String too long");
     }
-    return alloc(text, len);
+    size = ALGN(ASTRSIZE + len + 1, STRUCT_AL);
+    if (len > STR_ARENALEN || size > (size_t) (aend - atop)) {
+	return alloc(text, len);
+    }
+
+    a = (ArenaStr *) atop;
+    str = chunknew (schunk) String(text, len, atop + ASTRSIZE);
+    a->str = str;
+    a->size = size;
+    atop += size;
+    alive++;
+    return str;
+}
+
+/*
+ * move the text of a string from the task arena to the heap
+ */
+void String::promote()
+{
+    char *p;
+
+    if (text < atop && text >= arena) {
+	((ArenaStr *) (text - ASTRSIZE))->str = (String *) NULL;
+	--alive;
+	p = ALLOC(char, len + 1);
+	memcpy(p, text, len + 1);
+	text = p;
+    }
+}
+
+/*
+ * promote the strings that survived the task, and reset the task arena
+ */
+void String::endTask()
+{
+    char *p;
+    ArenaStr *a;
+
+    for (p = arena; alive != 0; p += a->size) {
+	a = (ArenaStr *) p;
+	if (a->str != (String *) NULL) {
+	    a->str->promote();
+	}
+    }
+# ifdef DEBUG
+    memset(arena, '\xdd', atop - arena);
+# endif
+    atop = arena;
 }
 
 /*
@@ -90,6 +171,8 @@ void String::del()
 void String::clean()
 {
     schunk.clean();
+    atop = arena;
+    alive = 0;
 }
 
 /*
@@ -196,6 +279,37 @@ String *String::add(String *str)
     return s;
 }
 
+/*
+ * Append a string to this one, in place.  The caller must hold the only
+ * reference.  The text grows in powers of two, so that appending to the
+ * same string repeatedly takes linear time.
+ */
+void String::append(String *str)
+{
+    long size;
+    size_t cap;
+    char *p;
+
+    size = (long) len + str->len;
+    if (size > (long) MAX_STRLEN) {
+	EC->error("String too long");
+    }
+    for (cap = STR_APPEND; cap <= (size_t) size; cap <<= 1) ;
+
+    if (text < atop && text >= arena) {
+	/* move out of the task arena */
+	((ArenaStr *) (text - ASTRSIZE))->str = (String *) NULL;
+	--alive;
+	p = ALLOC(char, cap);
+	memcpy(p, text, len);
+	text = p;
+    } else {
+	text = REALLOC(text, char, len + 1, cap);
+    }
+    memcpy(text + len, str->text, str->len);
+    text[len = size] = '\0';
+}
+
 /*
  * index a string
  */
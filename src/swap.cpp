@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -21,12 +21,18 @@
 # include "dgd.h"
 # include "hash.h"
 # include "swap.h"
+# ifdef SWAPMMAP
+# include <sys/mman.h>
+# endif
 
 static char *swapfile;			/* swap file name */
 static int swap;			/* swap file descriptor */
 static int dump, dump2;			/* snapshot descriptors */
 static char *mem;			/* swap slots in memory */
 static Sector *map, *smap;		/* sector map, swap free map */
+static Uint *mindex;			/* map sectors in the snapshot */
+static Uint *mdirty;			/* map sectors changed since snapshot */
+static unsigned int mentries;		/* # map entries in a sector */
 static Sector mfree, sfree;		/* free sector lists */
 static char *cbuf;			/* sector buffer */
 static Sector cached;			/* sector currently cached in cbuf */
@@ -41,6 +47,16 @@ static Sector nfree;			/* # free sectors */
 static Sector ssectors;			/* sectors actually in swap file */
 static Sector sbarrier;			/* swap sector barrier */
 static bool swapping;			/* currently using a swapfile? */
+# ifdef SWAPMMAP
+static char *smem;			/* mapped swap file */
+static off_t smemsize;			/* size of mapped swap file */
+# endif
+
+# define MDIRTY(sec)	BSET(mdirty, (sec) / mentries)
+
+# define LZ_MINMATCH	4		/* minimum match length */
+# define LZ_HASHBITS	12		/* log2 of LZ77 hash table size */
+# define LZ_HASHSZ	(1 << LZ_HASHBITS)
 
 /*
  * initialize the swap device
@@ -61,6 +77,11 @@ void Swap::init(char *file, unsigned int total, unsigned int secsize)
     smap = ALLOC(Sector, total);
     cbuf = ALLOC(char, secsize);
     cached = SW_UNUSED;
+    mentries = secsize / sizeof(Sector);
+    i = (total + mentries - 1) / mentries;
+    mindex = ALLOC(Uint, i);
+    mdirty = ALLOC(Uint, BMAP(i));
+    memset(mdirty, '\0', BMAP(i) * sizeof(Uint));
 
     /* 0 sectors allocated */
     nsectors = 0;
@@ -86,6 +107,10 @@ void Swap::init(char *file, unsigned int total, unsigned int secsize)
 
     swap = dump = -1;
     swapping = TRUE;
+# ifdef SWAPMMAP
+    smem = (char *) NULL;
+    smemsize = 0;
+# endif
 }
 
 /*
@@ -93,6 +118,9 @@ void Swap::init(char *file, unsigned int total, unsigned int secsize)
  */
 void Swap::finish()
 {
+# ifdef SWAPMMAP
+    unmap();
+# endif
     if (swap >= 0) {
 	char buf[STRINGSZ];
 
@@ -135,6 +163,81 @@ void Swap::create()
     }
 }
 
+/*
+ * allocate a sector in the swap file
+ */
+Sector Swap::salloc()
+{
+    Sector sec;
+
+    if (sfree == SW_UNUSED) {
+	if (ssectors == SW_UNUSED) {
+	    EC->fatal("out of sectors");
+	}
+	sec = ssectors++;
+    } else {
+	sec = sfree;
+	sfree = smap[sec];
+	sec += sbarrier;
+    }
+    return sec;
+}
+
+# ifdef SWAPMMAP
+/*
+ * return the address of a sector in the mapped swap file, creating or
+ * extending the mapping as needed
+ */
+char *Swap::mapped(Sector sec)
+{
+    off_t size;
+    struct stat sb;
+
+    size = (off_t) (sec + 2L) * sectorsize;
+    if (size > smemsize) {
+	if (swap < 0) {
+	    create();
+	}
+	unmap();
+
+	if (P_fstat(swap, &sb) < 0) {
+	    EC->fatal("cannot map swap file");
+	}
+	if (size <= sb.st_size) {
+	    size = sb.st_size;
+	} else {
+	    /* at least double the file, to keep remapping rare */
+	    if (size < 2 * sb.st_size) {
+		size = 2 * sb.st_size;
+	    }
+	    if (ftruncate(swap, size) < 0) {
+		EC->fatal("cannot extend swap file");
+	    }
+	}
+	smem = (char *) mmap((void *) NULL, size, PROT_READ | PROT_WRITE,
+			     MAP_SHARED, swap, 0);
+	if (smem == (char *) MAP_FAILED) {
+	    smem = (char *) NULL;
+	    EC->fatal("cannot map swap file");
+	}
+	smemsize = size;
+    }
+    return smem + (off_t) (sec + 1L) * sectorsize;
+}
+
+/*
+ * remove the swap file mapping
+ */
+void Swap::unmap()
+{
+    if (smem != (char *) NULL) {
+	munmap(smem, smemsize);
+	smem = (char *) NULL;
+	smemsize = 0;
+    }
+}
+# endif
+
 /*
  * count the number of sectors required for size bytes + a map
  */
@@ -164,6 +267,7 @@ void Swap::newv(Sector *vec, unsigned int size)
 	    return;
 	}
 	mfree = map[*vec = mfree];
+	MDIRTY(*vec);
 	map[*vec++] = SW_UNUSED;
 	--nfree;
 	--size;
@@ -174,6 +278,7 @@ void Swap::newv(Sector *vec, unsigned int size)
 	if (nsectors == swapsize) {
 	    EC->fatal("out of sectors");
 	}
+	MDIRTY(nsectors);
 	map[*vec++ = nsectors++] = SW_UNUSED;
 	--size;
     }
@@ -198,6 +303,7 @@ void Swap::wipev(Sector *vec, unsigned int size)
 	} else {
 	    map[sec] = SW_UNUSED;
 	}
+	MDIRTY(sec);
 	if (i != SW_UNUSED && i >= sbarrier) {
 	    /*
 	     * free sector in swap file
@@ -258,6 +364,7 @@ void Swap::delv(Sector *vec, unsigned int size)
 	 * put sec in free sector list
 	 */
 	map[sec] = mfree;
+	MDIRTY(sec);
 	mfree = sec;
 	nfree++;
 
@@ -336,18 +443,13 @@ Swap::SwapSlot *Swap::load(Sector sec, bool restore, bool fill)
 		    /*
 		     * allocate new sector in swap file
 		     */
-		    if (sfree == SW_UNUSED) {
-			if (ssectors == SW_UNUSED) {
-			    EC->fatal("out of sectors");
-			}
-			save = ssectors++;
-		    } else {
-			save = sfree;
-			sfree = smap[save];
-			save += sbarrier;
-		    }
+		    save = salloc();
+		    MDIRTY(h->sec);
 		}
 
+# ifdef SWAPMMAP
+		memcpy(mapped(save), h + 1, sectorsize);
+# else
 		if (swap < 0) {
 		    create();
 		}
@@ -355,6 +457,7 @@ Swap::SwapSlot *Swap::load(Sector sec, bool restore, bool fill)
 		if (!write(swap, h + 1, sectorsize)) {
 		    EC->fatal("cannot write swap file");
 		}
+# endif
 	    }
 	    map[h->sec] = save;
 	}
@@ -379,10 +482,14 @@ Swap::SwapSlot *Swap::load(Sector sec, bool restore, bool fill)
 		/*
 		 * load the sector from the swap file
 		 */
+# ifdef SWAPMMAP
+		memcpy(h + 1, mapped(load), sectorsize);
+# else
 		P_lseek(swap, (off_t) (load + 1L) * sectorsize, SEEK_SET);
 		if (P_read(swap, (char *) (h + 1), sectorsize) <= 0) {
 		    EC->fatal("cannot read swap file");
 		}
+# endif
 	    }
 	} else if (fill) {
 	    /* zero-fill new sector */
@@ -421,6 +528,65 @@ Swap::SwapSlot *Swap::load(Sector sec, bool restore, bool fill)
     return h;
 }
 
+/*
+ * return the contents of a sector, for reading
+ */
+char *Swap::rsector(Sector sec)
+{
+# ifdef SWAPMMAP
+    Sector i;
+
+    i = map[sec];
+    if (i != SW_UNUSED &&
+	(i >= cachesize ||
+	 ((SwapSlot *) (mem + i * slotsize))->sec != sec)) {
+	/* read directly from the swap file */
+	return mapped(i);
+    }
+# endif
+    return (char *) (load(sec, FALSE, TRUE) + 1);
+}
+
+/*
+ * return the contents of a sector, for writing.  If fill == TRUE, the
+ * previous contents must be preserved
+ */
+char *Swap::wsector(Sector sec, bool fill)
+{
+    SwapSlot *h;
+# ifdef SWAPMMAP
+    Sector i, save;
+    char *p;
+
+    i = map[sec];
+    if (i >= cachesize ||
+	((SwapSlot *) (mem + i * slotsize))->sec != sec) {
+	/*
+	 * write directly to the swap file
+	 */
+	if (i != SW_UNUSED && i >= sbarrier) {
+	    return mapped(i);
+	}
+	save = salloc();
+	p = mapped(save);
+	if (fill) {
+	    if (i == SW_UNUSED) {
+		memset(p, '\0', sectorsize);
+	    } else {
+		/* copy sector from a previous snapshot */
+		memcpy(p, mapped(i), sectorsize);
+	    }
+	}
+	map[sec] = save;
+	MDIRTY(sec);
+	return p;
+    }
+# endif
+    h = load(sec, FALSE, fill);
+    h->dirty = TRUE;
+    return (char *) (h + 1);
+}
+
 /*
  * read bytes from a vector of sectors
  */
@@ -432,27 +598,64 @@ void Swap::readv(char *m, Sector *vec, Uint size, Uint idx)
     idx %= sectorsize;
     do {
 	len = (size > sectorsize - idx) ? sectorsize - idx : size;
-	memcpy(m, (char *) (load(*vec++, FALSE, TRUE) + 1) + idx, len);
+	memcpy(m, rsector(*vec++) + idx, len);
 	idx = 0;
 	m += len;
     } while ((size -= len) > 0);
 }
 
+/*
+ * announce that a vector of sectors will be read soon, so that those in
+ * the swap file can be fetched while the interpreter does other work
+ */
+void Swap::prefetch(Sector *vec, Sector n)
+{
+    Sector sec, start, len;
+
+    if (swap < 0) {
+	return;
+    }
+    start = SW_UNUSED;
+    len = 0;
+    while (n != 0) {
+	sec = map[*vec++];
+	--n;
+	if (sec < cachesize &&
+	    ((SwapSlot *) (mem + sec * slotsize))->sec == vec[-1]) {
+	    continue;	/* in cache already */
+	}
+	if (sec == SW_UNUSED) {
+	    continue;
+	}
+	if (len != 0 && sec == start + len) {
+	    len++;	/* extend run of consecutive sectors */
+	    continue;
+	}
+	if (len != 0) {
+	    P_prefetch(swap, (off_t) (start + 1L) * sectorsize,
+		       (off_t) len * sectorsize);
+	}
+	start = sec;
+	len = 1;
+    }
+    if (len != 0) {
+	P_prefetch(swap, (off_t) (start + 1L) * sectorsize,
+		   (off_t) len * sectorsize);
+    }
+}
+
 /*
  * write bytes to a vector of sectors
  */
 void Swap::writev(char *m, Sector *vec, Uint size, Uint idx)
 {
-    SwapSlot *h;
     unsigned int len;
 
     vec += idx / sectorsize;
     idx %= sectorsize;
     do {
 	len = (size > sectorsize - idx) ? sectorsize - idx : size;
-	h = load(*vec++, FALSE, (len != sectorsize));
-	h->dirty = TRUE;
-	memcpy((char *) (h + 1) + idx, m, len);
+	memcpy(wsector(*vec++, (len != sectorsize)) + idx, m, len);
 	idx = 0;
 	m += len;
     } while ((size -= len) > 0);
@@ -470,6 +673,7 @@ void Swap::dreadv(char *m, Sector *vec, Uint size, Uint idx)
     idx %= sectorsize;
     do {
 	len = (size > sectorsize - idx) ? sectorsize - idx : size;
+	MDIRTY(*vec);
 	h = load(*vec++, TRUE, FALSE);
 	h->swap = SW_UNUSED;
 	memcpy(m, (char *) (h + 1) + idx, len);
@@ -495,6 +699,7 @@ void Swap::conv(char *m, Sector *vec, Uint size, Uint idx)
 		EC->fatal("cannot read snapshot");
 	    }
 	    map[cached = *vec] = SW_UNUSED;
+	    MDIRTY(*vec);
 	}
 	vec++;
 	memcpy(m, cbuf + idx, len);
@@ -521,6 +726,7 @@ void Swap::conv2(char *m, Sector *vec, Uint size, Uint idx)
 		EC->fatal("cannot read secondary snapshot");
 	    }
 	    map[cached = *vec] = SW_UNUSED;
+	    MDIRTY(*vec);
 	}
 	vec++;
 	memcpy(m, cbuf + idx, len);
@@ -548,9 +754,9 @@ Uint Swap::convert(char *m, Sector *vec, const char *layout, Uint n, Uint idx,
 }
 
 /*
- * compress data
+ * compress data with a bitwise predictor
  */
-Uint Swap::compress(char *data, char *text, Uint size)
+Uint Swap::predCompress(char *data, char *text, Uint size)
 {
     char htab[16384];
     unsigned short buf, bufsize, x;
@@ -617,11 +823,11 @@ Uint Swap::compress(char *data, char *text, Uint size)
 }
 
 /*
- * read and decompress data from the swap file
+ * read and decompress predictor-compressed data from the swap file
  */
-char *Swap::decompress(Sector *sectors,
-		       void (*readv) (char*, Sector*, Uint, Uint),
-		       Uint size, Uint offset, Uint *dsize)
+char *Swap::predDecompress(Sector *sectors,
+			   void (*readv) (char*, Sector*, Uint, Uint),
+			   Uint size, Uint offset, Uint *dsize)
 {
     char buffer[8192], htab[16384];
     unsigned short buf, bufsize, x;
@@ -687,6 +893,221 @@ char *Swap::decompress(Sector *sectors,
     }
 }
 
+/*
+ * append an LZ77 sequence: literals, followed by a match if len != 0
+ */
+static char *lzSequence(char *q, char *qend, char *lit, Uint nlit, Uint offset,
+			Uint len)
+{
+    Uint n;
+
+    if (q + 1 + nlit + nlit / 255 + 1 + 2 + len / 255 + 1 > qend) {
+	return (char *) NULL;	/* out of space */
+    }
+
+    /* token */
+    n = (len != 0) ? len - LZ_MINMATCH : 0;
+    *q++ = ((nlit < 15) ? nlit << 4 : 0xf0) | ((n < 15) ? n : 0x0f);
+
+    /* literals */
+    if (nlit >= 15) {
+	for (n = nlit - 15; n >= 255; n -= 255) {
+	    *q++ = (char) 255;
+	}
+	*q++ = n;
+    }
+    memcpy(q, lit, nlit);
+    q += nlit;
+
+    if (len != 0) {
+	/* match */
+	*q++ = offset;
+	*q++ = offset >> 8;
+	if (len - LZ_MINMATCH >= 15) {
+	    for (n = len - LZ_MINMATCH - 15; n >= 255; n -= 255) {
+		*q++ = (char) 255;
+	    }
+	    *q++ = n;
+	}
+    }
+
+    return q;
+}
+
+/*
+ * compress data with a fast LZ77 codec
+ */
+Uint Swap::lzCompress(char *data, char *text, Uint size)
+{
+    Uint htab[LZ_HASHSZ];
+    char *p, *q, *lit, *match, *end, *limit, *qend;
+    Uint x, h, len;
+
+    if (size <= 4 + LZ_MINMATCH) {
+	/* can't get smaller than this */
+	return 0;
+    }
+
+    /* clear the hash table */
+    memset(htab, '\0', sizeof(htab));
+
+    q = data;
+    *q++ = size >> 24;
+    *q++ = size >> 16;
+    *q++ = size >> 8;
+    *q++ = size;
+    qend = data + size - 1;
+
+    p = lit = text;
+    end = text + size;
+    limit = end - LZ_MINMATCH;
+    while (p < limit) {
+	memcpy(&x, p, sizeof(Uint));
+	h = (x * 2654435761U) >> (32 - LZ_HASHBITS);
+	match = text + htab[h];
+	htab[h] = p - text;
+	if (match >= p || p - match > 0xffff ||
+	    memcmp(match, p, LZ_MINMATCH) != 0) {
+	    /* no match: skip ahead faster in data that doesn't compress */
+	    p += 1 + ((p - lit) >> 6);
+	    continue;
+	}
+
+	/* extend the match */
+	for (len = LZ_MINMATCH; p + len < end && match[len] == p[len]; len++) ;
+	q = lzSequence(q, qend, lit, p - lit, p - match, len);
+	if (q == (char *) NULL) {
+	    return 0;	/* out of space */
+	}
+	p = lit = p + len;
+    }
+
+    /* final literals */
+    q = lzSequence(q, qend, lit, end - lit, 0, 0);
+    if (q == (char *) NULL) {
+	return 0;	/* compression did not reduce size */
+    }
+
+    return (intptr_t) q - (intptr_t) data;
+}
+
+/*
+ * read and decompress LZ77-compressed data from the swap file
+ */
+char *Swap::lzDecompress(Sector *sectors,
+			 void (*readv) (char*, Sector*, Uint, Uint),
+			 Uint size, Uint offset, Uint *dsize)
+{
+    char *buffer, *p, *pend, *q, *qend, *match;
+    Uint n, token;
+
+    buffer = ALLOC(char, size);
+    (*readv)(buffer, sectors, size, offset);
+    p = buffer;
+    pend = buffer + size;
+    *dsize = (UCHAR(p[0]) << 24) | (UCHAR(p[1]) << 16) | (UCHAR(p[2]) << 8) |
+	     UCHAR(p[3]);
+    p += 4;
+    q = ALLOC(char, *dsize);
+    qend = q + *dsize;
+
+    while (p < pend) {
+	token = UCHAR(*p++);
+
+	/* literals */
+	n = token >> 4;
+	if (n == 15) {
+	    do {
+		if (p == pend) {
+		    EC->fatal("bad compressed data");
+		}
+		n += UCHAR(*p);
+	    } while (UCHAR(*p++) == 255);
+	}
+	if (n > (Uint) (pend - p) || n > (Uint) (qend - q)) {
+	    EC->fatal("bad compressed data");
+	}
+	memcpy(q, p, n);
+	p += n;
+	q += n;
+	if (p == pend) {
+	    break;	/* final literals */
+	}
+
+	/* match */
+	if (pend - p < 2) {
+	    EC->fatal("bad compressed data");
+	}
+	match = q - (UCHAR(p[0]) | (UCHAR(p[1]) << 8));
+	p += 2;
+	n = token & 0x0f;
+	if (n == 15) {
+	    do {
+		if (p == pend) {
+		    EC->fatal("bad compressed data");
+		}
+		n += UCHAR(*p);
+	    } while (UCHAR(*p++) == 255);
+	}
+	n += LZ_MINMATCH;
+	if (match < qend - *dsize || match == q || n > (Uint) (qend - q)) {
+	    EC->fatal("bad compressed data");
+	}
+	if (q - match >= (intptr_t) n) {
+	    memcpy(q, match, n);
+	    q += n;
+	} else {
+	    /* overlapping copy */
+	    do {
+		*q++ = *match++;
+	    } while (--n != 0);
+	}
+    }
+
+    FREE(buffer);
+    if (q != qend) {
+	EC->fatal("bad compressed data");
+    }
+    return qend - *dsize;
+}
+
+/*
+ * compress data with the given codec, return the compressed size or 0
+ */
+Uint Swap::compress(char *data, char *text, Uint size, int codec)
+{
+    switch (codec) {
+    case CMP_PRED:
+	return predCompress(data, text, size);
+
+    case CMP_LZ:
+	return lzCompress(data, text, size);
+
+    default:
+	return 0;
+    }
+}
+
+/*
+ * read and decompress data from the swap file
+ */
+char *Swap::decompress(Sector *sectors,
+		       void (*readv) (char*, Sector*, Uint, Uint),
+		       Uint size, Uint offset, Uint *dsize, int codec)
+{
+    switch (codec) {
+    case CMP_PRED:
+	return predDecompress(sectors, readv, size, offset, dsize);
+
+    case CMP_LZ:
+	return lzDecompress(sectors, readv, size, offset, dsize);
+
+    default:
+	EC->fatal("unknown compression codec %d", codec);
+	return (char *) NULL;
+    }
+}
+
 /*
  * return the number of sectors presently in use
  */
@@ -696,6 +1117,106 @@ Sector Swap::count()
 }
 
 
+# ifdef FORKDUMP
+/*
+ * keep the sectors now in the swap file from being overwritten, while a
+ * snapshot is made of them in the background
+ */
+bool Swap::freeze()
+{
+    if (!swapping) {
+	return FALSE;	/* swap file is also the last snapshot */
+    }
+    sbarrier = ssectors;
+    sfree = SW_UNUSED;
+    return TRUE;
+}
+
+/*
+ * continue with a private copy of the swap file, in the process that
+ * writes the snapshot
+ */
+void Swap::detach(char *snapshot)
+{
+    static char file[STRINGSZ + 4];
+    int old;
+    Sector n;
+
+# ifdef SWAPMMAP
+    unmap();
+# endif
+    snprintf(file, sizeof(file), "%s.tmp", snapshot);
+    if (swap >= 0) {
+	/* the file offset of the inherited descriptor is shared */
+	old = P_open(swapfile, O_RDONLY | O_BINARY, 0);
+	P_close(swap);
+	swap = P_open(file, O_RDWR | O_CREAT | O_TRUNC | O_BINARY, 0600);
+	if (old < 0 || swap < 0) {
+	    EC->fatal("cannot copy swap file");
+	}
+	for (n = ssectors + 1; n > 0; --n) {
+	    if (P_read(old, cbuf, sectorsize) <= 0) {
+		EC->fatal("cannot read swap file");
+	    }
+	    if (!write(swap, cbuf, sectorsize)) {
+		EC->fatal("cannot write snapshot");
+	    }
+	}
+	P_close(old);
+    }
+    swapfile = file;
+}
+
+/*
+ * the snapshot has been written: reclaim the sectors in the swap file that
+ * are no longer in use
+ */
+void Swap::thaw()
+{
+    Sector sec, i;
+    SwapSlot *h;
+    char *used, *deleted;
+
+    if (sbarrier == 0) {
+	return;
+    }
+    used = ALLOC(char, ssectors);
+    memset(used, '\0', ssectors);
+    deleted = ALLOC(char, nsectors);
+    memset(deleted, '\0', nsectors);
+
+    /* the map links deleted sectors */
+    for (sec = mfree; sec != SW_UNUSED; sec = map[sec]) {
+	deleted[sec] = TRUE;
+    }
+    for (sec = 0; sec < nsectors; sec++) {
+	if (!deleted[sec]) {
+	    i = map[sec];
+	    if (i < cachesize &&
+		(h=(SwapSlot *) (mem + i * slotsize))->sec == sec) {
+		i = h->swap;
+	    }
+	    if (i < ssectors) {
+		used[i] = TRUE;
+	    }
+	}
+    }
+
+    /* rebuild the free list from scratch */
+    sbarrier = 0;
+    sfree = SW_UNUSED;
+    for (i = (ssectors < swapsize) ? ssectors : swapsize; i > 0; ) {
+	if (!used[--i]) {
+	    smap[i] = sfree;
+	    sfree = i;
+	}
+    }
+
+    FREE(deleted);
+    FREE(used);
+}
+# endif
+
 struct DumpHeader {
     Uint secsize;		/* size of swap sector */
     Sector nsectors;		/* # sectors */
@@ -706,6 +1227,53 @@ struct DumpHeader {
 
 static char dh_layout[] = "idddd";
 
+/*
+ * Write the sector map to the snapshot: an index of map sectors, followed by
+ * the map sectors that changed since the previous snapshot in the same file.
+ * Unchanged map sectors remain where the index already points to.
+ */
+void Swap::savemap()
+{
+    Sector n, i;
+    Uint sec;
+    unsigned int size;
+
+    n = (nsectors + mentries - 1) / mentries;
+    size = (n * sizeof(Uint)) % sectorsize;
+    sec = ssectors + 1L + (n * sizeof(Uint) + sectorsize - 1) / sectorsize;
+    for (i = 0; i < n; i++) {
+	if (swapping || BTST(mdirty, i)) {
+	    mindex[i] = sec++;
+	}
+    }
+
+    /* index */
+    memset(cbuf, '\0', sectorsize);
+    if (!write(swap, mindex, n * sizeof(Uint)) ||
+	(size != 0 && !write(swap, cbuf, sectorsize - size))) {
+	EC->fatal("cannot write sector map to snapshot");
+    }
+
+    /* changed map sectors */
+    for (i = 0; i < n; i++) {
+	if (swapping || BTST(mdirty, i)) {
+	    if (i == n - 1) {
+		size = (nsectors - i * mentries) * sizeof(Sector);
+		memcpy(cbuf, map + i * mentries, size);
+		memset(cbuf + size, '\0', sectorsize - size);
+		if (!write(swap, cbuf, sectorsize)) {
+		    EC->fatal("cannot write sector map to snapshot");
+		}
+	    } else if (!write(swap, map + i * mentries,
+			      mentries * sizeof(Sector))) {
+		EC->fatal("cannot write sector map to snapshot");
+	    }
+	}
+    }
+    memset(mdirty, '\0', BMAP(n) * sizeof(Uint));
+    cached = SW_UNUSED;
+}
+
 /*
  * create snapshot
  */
@@ -731,25 +1299,28 @@ int Swap::save(char *snapshot, bool keep)
 		/*
 		 * allocate new sector in swap file
 		 */
-		if (sfree == SW_UNUSED) {
-		    if (ssectors == SW_UNUSED) {
-			EC->fatal("out of sectors");
-		    }
-		    sec = ssectors++;
-		} else {
-		    sec = sfree;
-		    sfree = smap[sec];
-		    sec += sbarrier;
-		}
+		sec = salloc();
 		h->swap = sec;
+		MDIRTY(h->sec);
 	    }
+# ifdef SWAPMMAP
+	    memcpy(mapped(sec), h + 1, sectorsize);
+# else
 	    P_lseek(swap, (off_t) (sec + 1L) * sectorsize, SEEK_SET);
 	    if (!write(swap, h + 1, sectorsize)) {
 		EC->fatal("cannot write swap file");
 	    }
+# endif
 	}
 	map[h->sec] = sec;
     }
+# ifdef SWAPMMAP
+    /* the snapshot ends with the sector map, right after the swap sectors */
+    unmap();
+    if (ftruncate(swap, (off_t) (ssectors + 1L) * sectorsize) < 0) {
+	EC->fatal("cannot truncate swap file");
+    }
+# endif
 
     if (dump >= 0 && !keep) {
 	P_close(dump);
@@ -808,9 +1379,7 @@ int Swap::save(char *snapshot, bool keep)
 
     /* write map */
     P_lseek(swap, (off_t) (ssectors + 1L) * sectorsize, SEEK_SET);
-    if (!write(swap, map, nsectors * sizeof(Sector))) {
-	EC->fatal("cannot write sector map to snapshot");
-    }
+    savemap();
 
     /* fix the sector map */
     for (h = last; h != (SwapSlot *) NULL; h = h->prev) {
@@ -899,10 +1468,40 @@ void Swap::save2(SnapshotInfo *header, int size, bool incr)
     cached = SW_UNUSED;
 }
 
+/*
+ * restore the sector map from the map sectors in the snapshot, and seek
+ * beyond them
+ */
+void Swap::restoremap(int fd, unsigned int secsize, Sector nsectors,
+		      Sector ssectors)
+{
+    Sector n, i, entries;
+    Uint *index;
+    off_t end;
+
+    entries = secsize / (Config::dsize("d") & 0xff);
+    n = (nsectors + entries - 1) / entries;
+    index = ALLOC(Uint, n + 1);
+    Config::dread(fd, (char *) index, "i", (Uint) n);
+    end = ssectors + 1L + ((Config::dsize("i") & 0xff) * n + secsize - 1) /
+			  secsize;
+    for (i = 0; i < n; i++) {
+	P_lseek(fd, (off_t) index[i] * secsize, SEEK_SET);
+	Config::dread(fd, (char *) (map + i * entries), "d",
+		      (Uint) ((i == n - 1) ? nsectors - i * entries : entries));
+	if (index[i] >= end) {
+	    end = index[i] + 1L;
+	}
+    }
+    FREE(index);
+
+    P_lseek(fd, end * secsize, SEEK_SET);
+}
+
 /*
  * restore snapshot
  */
-void Swap::restore(int fd, unsigned int secsize)
+void Swap::restore(int fd, unsigned int secsize, bool conv_18)
 {
     DumpHeader dh;
 
@@ -924,7 +1523,11 @@ void Swap::restore(int fd, unsigned int secsize)
     P_lseek(fd, (off_t) (dh.ssectors + 1L) * secsize, SEEK_SET);
 
     /* restore swap map */
-    Config::dread(fd, (char *) map, "d", (Uint) dh.nsectors);
+    if (conv_18) {
+	Config::dread(fd, (char *) map, "d", (Uint) dh.nsectors);
+    } else {
+	restoremap(fd, secsize, dh.nsectors, dh.ssectors);
+    }
     nsectors = dh.nsectors;
     mfree = dh.mfree;
     nfree = dh.nfree;
@@ -1,7 +1,7 @@
 /*
  * This file is part of DGD, https://github.com/dworkin/dgd
  * Copyright (C) 1993-2010 Dworkin B.V.
- * Copyright (C) 2010-2024 DGD Authors (see the commit log for details)
+ * Copyright (C) 2010-2026 DGD Authors (see the commit log for details)
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU Affero General Public License as
@@ -34,25 +34,56 @@ public:
     static void delv(Sector *vec, unsigned int size);
     static Sector alloc(Uint size, Sector nsectors, Sector **sectors);
     static void readv(char*, Sector*, Uint, Uint);
+    static void prefetch(Sector *vec, Sector n);
     static void writev(char*, Sector*, Uint, Uint);
     static void dreadv(char*, Sector*, Uint, Uint);
     static void conv(char*, Sector*, Uint, Uint);
     static void conv2(char*, Sector*, Uint, Uint);
     static Uint convert(char *m, Sector *vec, const char *layout, Uint n,
 			Uint idx, void (*readv) (char*, Sector*, Uint, Uint));
-    static Uint compress(char *data, char *text, Uint size);
+    static Uint compress(char *data, char *text, Uint size, int codec);
     static char *decompress(Sector *sectors,
 			    void (*readv) (char*, Sector*, Uint, Uint),
-			    Uint size, Uint offset, Uint *dsize);
+			    Uint size, Uint offset, Uint *dsize, int codec);
     static Sector count();
     static int save(char *snapshot, bool keep);
     static void save2(SnapshotInfo *header, int size, bool incr);
-    static void restore(int fd, unsigned int secsize);
+    static void restore(int fd, unsigned int secsize, bool conv_18);
     static void restore2(int fd);
+# ifdef FORKDUMP
+    static bool freeze();
+    static void detach(char *snapshot);
+    static void thaw();
+# endif
 
 private:
     static void create();
     static Sector mapsize(unsigned int size);
     static void newv(Sector *vec, unsigned int size);
     static SwapSlot *load(Sector sec, bool restore, bool fill);
+    static char *rsector(Sector sec);
+    static char *wsector(Sector sec, bool fill);
+    static Sector salloc();
+    static void savemap();
+    static void restoremap(int fd, unsigned int secsize, Sector nsectors,
+			   Sector ssectors);
+# ifdef SWAPMMAP
+    static char *mapped(Sector sec);
+    static void unmap();
+# endif
+    static Uint predCompress(char *data, char *text, Uint size);
+    static char *predDecompress(Sector *sectors,
+				void (*readv) (char*, Sector*, Uint, Uint),
+				Uint size, Uint offset, Uint *dsize);
+    static Uint lzCompress(char *data, char *text, Uint size);
+    static char *lzDecompress(Sector *sectors,
+			      void (*readv) (char*, Sector*, Uint, Uint),
+			      Uint size, Uint offset, Uint *dsize);
 };
+
+/* data compression */
+# define CMP_TYPE		0x03
+# define CMP_NONE		0x00	/* no compression */
+# define CMP_PRED		0x01	/* predictor compression */
+# define CMP_LZ			0x02	/* LZ77 compression */
+# define CMP_DEFAULT		CMP_LZ	/* used for newly written blocks */
@@ -0,0 +1,3 @@
+/*
+ * standard include file for the array set benchmark
+ */
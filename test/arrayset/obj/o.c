@@ -0,0 +1,5 @@
+/*
+ * object to clone for the array set benchmark
+ */
+
+int x;
@@ -0,0 +1,3 @@
+/*
+ * auto object for the array set benchmark
+ */
@@ -0,0 +1,360 @@
+/*
+ * Array set benchmark: time array subtraction, intersection, union and
+ * exclusive or, for arrays of ints, strings, objects and mixed values,
+ * after checking the results against a naive implementation.
+ *
+ * Run from the top directory with:  src/a.out test/arrayset.dgd
+ *
+ * Each line gives the time per operation in nanoseconds, followed by a
+ * checksum of the result sizes.
+ */
+
+object *objs;		/* objects to put in sets */
+
+/*
+ * NAME:	msg()
+ * DESCRIPTION:	output a line
+ */
+static void msg(string s)
+{
+    send_message(s + "\n");
+}
+
+/*
+ * NAME:	elapsed()
+ * DESCRIPTION:	return the microseconds elapsed since t0
+ */
+static int elapsed(mixed *t0)
+{
+    mixed *t;
+
+    t = millitime();
+    return (t[0] - t0[0]) * 1000000 + (int) ((t[1] - t0[1]) * 1000000.0);
+}
+
+/*
+ * NAME:	make()
+ * DESCRIPTION:	create an array of n values of the given type
+ */
+static mixed *make(string type, int from, int n)
+{
+    mixed *a;
+    int i;
+
+    a = allocate(n);
+    for (i = 0; i < n; i++) {
+	switch (type) {
+	case "int":
+	    a[i] = (from + i) * 7919;
+	    break;
+	case "string":
+	    a[i] = "/players/user/inventory/item#" + (from + i);
+	    break;
+	case "object":
+	    a[i] = objs[from + i];
+	    break;
+	case "mixed":
+	    a[i] = ((from + i) & 1) ? from + i : "item#" + (from + i);
+	    break;
+	}
+    }
+    return a;
+}
+
+/*
+ * NAME:	bench()
+ * DESCRIPTION:	time the set operators on two arrays that half overlap
+ */
+static void bench(string type, int n)
+{
+    mixed *a, *b, *c;
+    mixed *t;
+    int reps, i, check;
+    string line;
+
+    a = make(type, 0, n);
+    b = make(type, n / 2, n);	/* half overlap */
+    reps = 2000000 / n;
+    if (reps < 3) {
+	reps = 3;
+    }
+    line = type + " " + n + ":";
+    check = 0;
+
+    t = millitime();
+    for (i = 0; i < reps; i++) {
+	c = a - b;
+    }
+    line += " sub " + (elapsed(t) * 1000 / reps);
+    check += sizeof(c);
+    t = millitime();
+    for (i = 0; i < reps; i++) {
+	c = a & b;
+    }
+    line += " and " + (elapsed(t) * 1000 / reps);
+    check += sizeof(c);
+    t = millitime();
+    for (i = 0; i < reps; i++) {
+	c = a | b;
+    }
+    line += " or " + (elapsed(t) * 1000 / reps);
+    check += sizeof(c);
+    t = millitime();
+    for (i = 0; i < reps; i++) {
+	c = a ^ b;
+    }
+    line += " xor " + (elapsed(t) * 1000 / reps);
+    check += sizeof(c);
+    msg(line + " ns  [" + check + "]");
+}
+
+/*
+ * NAME:	in()
+ * DESCRIPTION:	check if a value is in an array
+ */
+static int in(mixed x, mixed *b)
+{
+    int i;
+
+    for (i = 0; i < sizeof(b); i++) {
+	if (typeof(x) == typeof(b[i]) && x == b[i]) {
+	    return 1;
+	}
+    }
+    return 0;
+}
+
+/*
+ * NAME:	naive()
+ * DESCRIPTION:	keep the elements of a that are in b, or that are not
+ */
+static mixed *naive(mixed *a, mixed *b, int keep)
+{
+    mixed *c;
+    int i;
+
+    c = ({ });
+    for (i = 0; i < sizeof(a); i++) {
+	if (in(a[i], b) == keep) {
+	    c += ({ a[i] });
+	}
+    }
+    return c;
+}
+
+/*
+ * NAME:	same()
+ * DESCRIPTION:	check if two arrays hold the same values
+ */
+static int same(mixed *a, mixed *b)
+{
+    int i;
+
+    if (sizeof(a) != sizeof(b)) {
+	return 0;
+    }
+    for (i = 0; i < sizeof(a); i++) {
+	if (typeof(a[i]) != typeof(b[i]) || a[i] != b[i]) {
+	    return 0;
+	}
+    }
+    return 1;
+}
+
+/*
+ * NAME:	pick()
+ * DESCRIPTION:	pick a value of the given kind
+ */
+static mixed pick(int kind, int r)
+{
+    switch (kind) {
+    case 0:
+	return r;
+    case 1:
+	return "s" + r;
+    case 2:
+	return objs[r];
+    default:
+	switch (r % 4) {
+	case 0:
+	    return r;
+	case 1:
+	    return "s" + r;
+	case 2:
+	    return objs[r];
+	default:
+	    return nil;
+	}
+    }
+}
+
+/*
+ * NAME:	verify()
+ * DESCRIPTION:	check the set operators against naive() for random arrays
+ */
+static void verify()
+{
+    int round, kind, i, n, m, bad;
+    mixed *a, *b;
+
+    bad = 0;
+    for (round = 0; round < 400; round++) {
+	kind = round % 4;
+	n = random(60);
+	m = random(60);
+	a = allocate(n);
+	b = allocate(m);
+	for (i = 0; i < n; i++) {
+	    a[i] = (random(10) == 0) ? nil : pick(kind, random(40));
+	}
+	for (i = 0; i < m; i++) {
+	    b[i] = (random(10) == 0) ? nil : pick(kind, random(40));
+	}
+	if (round == 200) {
+	    destruct_object(objs[7]);
+	    destruct_object(objs[8]);
+	}
+	if (!same(a - b, naive(a, b, 0)) || !same(a & b, naive(a, b, 1)) ||
+	    !same(a | b, a + naive(b, a, 0)) ||
+	    !same(a ^ b, naive(a, b, 0) + naive(b, a, 0))) {
+	    bad++;
+	}
+    }
+    msg("verify bad " + bad);
+}
+
+/*
+ * NAME:	run()
+ * DESCRIPTION:	verify, then benchmark
+ */
+static void run()
+{
+    int *sizes, i;
+
+    sizes = ({ 4, 8, 16, 32, 64, 128, 1024, 8192, 16000 });
+    verify();
+    for (i = 0; i < sizeof(sizes); i++) {
+	bench("int", sizes[i]);
+	bench("string", sizes[i]);
+	bench("object", sizes[i]);
+	bench("mixed", sizes[i]);
+    }
+    shutdown();
+}
+
+/*
+ * NAME:	path_read()
+ * DESCRIPTION:	translate a path for reading
+ */
+string path_read(string path)
+{
+    return path;
+}
+
+/*
+ * NAME:	path_write()
+ * DESCRIPTION:	translate a path for writing
+ */
+string path_write(string path)
+{
+    return path;
+}
+
+/*
+ * NAME:	call_object()
+ * DESCRIPTION:	translate a string to an object
+ */
+object call_object(string path)
+{
+    object obj;
+
+    obj = find_object(path);
+    return (obj) ? obj : compile_object(path);
+}
+
+/*
+ * NAME:	inherit_program()
+ * DESCRIPTION:	find the object to inherit
+ */
+object inherit_program(string from, string path, int priv)
+{
+    object obj;
+
+    obj = find_object(path);
+    return (obj) ? obj : compile_object(path);
+}
+
+/*
+ * NAME:	include_file()
+ * DESCRIPTION:	translate an include path
+ */
+string include_file(string from, string path)
+{
+    return path;
+}
+
+/*
+ * NAME:	object_type()
+ * DESCRIPTION:	translate an object type
+ */
+string object_type(string from, string obj)
+{
+    return obj;
+}
+
+/*
+ * NAME:	compile_error()
+ * DESCRIPTION:	report a compile error
+ */
+void compile_error(string file, int line, string err)
+{
+    send_message(file + ", " + line + ": " + err + "\n");
+}
+
+/*
+ * NAME:	runtime_error()
+ * DESCRIPTION:	report a runtime error
+ */
+void runtime_error(string error, int caught, int ticks)
+{
+    if (!caught) {
+	send_message("arrayset: " + error + "\n");
+	shutdown();
+    }
+}
+
+/*
+ * NAME:	atomic_error()
+ * DESCRIPTION:	report a runtime error in atomic code
+ */
+void atomic_error(string error, int atom, int ticks)
+{
+    send_message("arrayset: " + error + "\n");
+}
+
+/*
+ * NAME:	interrupt()
+ * DESCRIPTION:	deal with an interrupt
+ */
+void interrupt()
+{
+    shutdown();
+}
+
+/*
+ * NAME:	initialize()
+ * DESCRIPTION:	create objects and start the benchmark
+ */
+static void initialize()
+{
+    int i;
+    object o;
+
+    o = compile_object("/obj/o");
+    objs = allocate(30001);
+    for (i = 0; i < 30001; i++) {
+	objs[i] = clone_object(o);
+    }
+    call_out("run", 0);
+}
+
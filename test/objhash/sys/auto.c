@@ -0,0 +1,3 @@
+/*
+ * auto object for the object name hash table test
+ */
@@ -0,0 +1,177 @@
+/*
+ * Object name hash table test: grow the table of an atomic plane while
+ * an object from an outer plane is copied to a nested plane.
+ *
+ * Run from the top directory with:  src/a.out test/objhash.dgd
+ *
+ * The names below were chosen for the string hash function in hash.h.
+ * All of them hash to bucket 4 of the initial plane table, alternating
+ * between buckets 4 and 261 once the table is doubled.  The failed lookup
+ * in inner() finds a chain of 8 entries and starts doubling the table;
+ * bucket 4 is then migrated by the lookup that puts the nested plane copy
+ * of the first object in the chain.
+ */
+
+string *names;		/* object names */
+object *objs;		/* compiled objects */
+
+/*
+ * NAME:	verify()
+ * DESCRIPTION:	count the objects that cannot be found by name
+ */
+static int verify()
+{
+    int i, bad;
+
+    for (i = bad = 0; i < sizeof(objs); i++) {
+	if (find_object(names[i]) != objs[i]) {
+	    bad++;
+	}
+    }
+    return bad;
+}
+
+/*
+ * NAME:	inner()
+ * DESCRIPTION:	grow the table and copy an object to a nested plane
+ */
+static atomic int inner()
+{
+    find_object("/obj/t2065");
+    call_touch(objs[0]);
+    return verify();
+}
+
+/*
+ * NAME:	outer()
+ * DESCRIPTION:	compile new objects in one chain, and check them in a
+ *		nested plane
+ */
+static atomic int outer()
+{
+    int i, bad;
+
+    names = ({ "/obj/t337", "/obj/t77", "/obj/t376", "/obj/t108",
+	       "/obj/t1130", "/obj/t826", "/obj/t1901", "/obj/t945" });
+    objs = allocate(sizeof(names));
+    for (i = 0; i < sizeof(names); i++) {
+	objs[i] = compile_object(names[i], "int x;");
+    }
+    catch {
+	bad = inner();
+    }
+    return bad + verify();
+}
+
+/*
+ * NAME:	path_read()
+ * DESCRIPTION:	translate a path for reading
+ */
+string path_read(string path)
+{
+    return path;
+}
+
+/*
+ * NAME:	path_write()
+ * DESCRIPTION:	translate a path for writing
+ */
+string path_write(string path)
+{
+    return path;
+}
+
+/*
+ * NAME:	call_object()
+ * DESCRIPTION:	translate a string to an object
+ */
+object call_object(string path)
+{
+    object obj;
+
+    obj = find_object(path);
+    return (obj) ? obj : compile_object(path);
+}
+
+/*
+ * NAME:	inherit_program()
+ * DESCRIPTION:	find the object to inherit
+ */
+object inherit_program(string from, string path, int priv)
+{
+    object obj;
+
+    obj = find_object(path);
+    return (obj) ? obj : compile_object(path);
+}
+
+/*
+ * NAME:	include_file()
+ * DESCRIPTION:	translate an include path
+ */
+string include_file(string from, string path)
+{
+    return path;
+}
+
+/*
+ * NAME:	object_type()
+ * DESCRIPTION:	translate an object type
+ */
+string object_type(string from, string obj)
+{
+    return obj;
+}
+
+/*
+ * NAME:	compile_error()
+ * DESCRIPTION:	report a compile error
+ */
+void compile_error(string file, int line, string err)
+{
+    send_message(file + ", " + line + ": " + err + "\n");
+}
+
+/*
+ * NAME:	runtime_error()
+ * DESCRIPTION:	report a runtime error
+ */
+void runtime_error(string error, int caught, int ticks)
+{
+    if (!caught) {
+	send_message("objhash: " + error + "\n");
+	shutdown();
+    }
+}
+
+/*
+ * NAME:	atomic_error()
+ * DESCRIPTION:	report a runtime error in atomic code
+ */
+void atomic_error(string error, int atom, int ticks)
+{
+    send_message("objhash: " + error + "\n");
+}
+
+/*
+ * NAME:	interrupt()
+ * DESCRIPTION:	deal with an interrupt
+ */
+void interrupt()
+{
+    shutdown();
+}
+
+/*
+ * NAME:	initialize()
+ * DESCRIPTION:	run the test
+ */
+static void initialize()
+{
+    int bad;
+
+    bad = outer();
+    send_message((bad == 0) ?
+		  "objhash: ok\n" : "objhash: FAILED, " + bad + " lost\n");
+    shutdown();
+}